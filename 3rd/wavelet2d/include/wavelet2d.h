@@ -125,6 +125,12 @@ EXPORT void* per_ext2d(vector<vector<double> > &,vector<vector<double> > &, int
 
 // FFT functions
 
+// planner flags used by convfft, FFTW_ESTIMATE by default
+EXPORT void set_convfft_planner_flags(unsigned int flags);
+
+// the fftw planner is not thread safe: convfft calls lock/unlock around creating and
+// destroying its plans so that the host library can share its planner lock, no locking by default
+EXPORT void set_convfft_planner_lock(void (*lock)(), void (*unlock)());
 
 EXPORT double convfft(vector<double> &, vector<double> &, vector<double> &);
 
@@ -40,6 +40,32 @@ using namespace std;
 
 fftw_plan plan_forward_inp,plan_forward_filt, plan_backward;
 static unsigned int transient_size_of_fft = 0;
+static unsigned int convfft_planner_flags = FFTW_ESTIMATE;
+static void (*convfft_planner_lock)() = 0;
+static void (*convfft_planner_unlock)() = 0;
+
+void set_convfft_planner_flags(unsigned int flags)
+{
+    convfft_planner_flags = flags;
+}
+
+void set_convfft_planner_lock(void (*lock)(), void (*unlock)())
+{
+    convfft_planner_lock = lock;
+    convfft_planner_unlock = unlock;
+}
+
+static void lock_convfft_planner()
+{
+    if (convfft_planner_lock)
+        convfft_planner_lock();
+}
+
+static void unlock_convfft_planner()
+{
+    if (convfft_planner_unlock)
+        convfft_planner_unlock();
+}
 
 void* per_ext2d(vector<vector<double> >& signal,vector<vector<double> >& temp2, int a)
 {
@@ -1335,9 +1361,11 @@ double convfft(vector<double>& a, vector<double>& b, vector<double>& c)
     temp_data = ( fftw_complex* ) fftw_malloc( sizeof( fftw_complex ) * sz );
     temp_ifft = ( fftw_complex* ) fftw_malloc( sizeof( fftw_complex ) * sz );
 
-    plan_forward_inp  = fftw_plan_dft_1d( sz, inp_data, inp_fft, FFTW_FORWARD, FFTW_ESTIMATE );
-    plan_forward_filt  = fftw_plan_dft_1d( sz, filt_data, filt_fft, FFTW_FORWARD, FFTW_ESTIMATE );
-    plan_backward = fftw_plan_dft_1d( sz, temp_data, temp_ifft, FFTW_BACKWARD, FFTW_ESTIMATE );
+    lock_convfft_planner();
+    plan_forward_inp  = fftw_plan_dft_1d( sz, inp_data, inp_fft, FFTW_FORWARD, convfft_planner_flags );
+    plan_forward_filt  = fftw_plan_dft_1d( sz, filt_data, filt_fft, FFTW_FORWARD, convfft_planner_flags );
+    plan_backward = fftw_plan_dft_1d( sz, temp_data, temp_ifft, FFTW_BACKWARD, convfft_planner_flags );
+    unlock_convfft_planner();
 
 
     for (unsigned int i =0; i < sz; i++) {
@@ -1388,9 +1416,11 @@ double convfft(vector<double>& a, vector<double>& b, vector<double>& c)
     fftw_free(filt_fft);
     fftw_free(temp_data);
     fftw_free(temp_ifft);
+    lock_convfft_planner();
     fftw_destroy_plan(plan_forward_inp);
     fftw_destroy_plan(plan_forward_filt);
     fftw_destroy_plan(plan_backward);
+    unlock_convfft_planner();
 
     return 0;
 }
@@ -8,12 +8,22 @@ macro(support_fftw target)
 
     set(_fftw_lib_dir "${FFTW_DIR}/lib")
 
-    find_library(_fftw_lib NAMES libfftw3-3 fftw3-3 HINTS "${_fftw_lib_dir}")
-    find_library(_fftwf_lib NAMES libfftw3f-3 fftw3f-3 HINTS "${_fftw_lib_dir}")
+    # prebuilt windows libraries are named libfftw3-3, *nix packages install libfftw3
+    find_library(_fftw_lib NAMES libfftw3-3 fftw3-3 fftw3 HINTS "${_fftw_lib_dir}")
+    find_library(_fftwf_lib NAMES libfftw3f-3 fftw3f-3 fftw3f HINTS "${_fftw_lib_dir}")
 
-    set(_libs ${_fftw_lib} ${_fftwf_lib})
+    if(NOT _fftw_lib)
+        message(FATAL_ERROR "can not find fftw3 library in ${_fftw_lib_dir} or system paths")
+    endif()
+
+    set(_libs ${_fftw_lib})
+    if(_fftwf_lib)
+        list(APPEND _libs ${_fftwf_lib})
+    endif()
     target_link_libraries(${target} ${_libs})
 
-    acmake_append_runtime_dirs(${target} ${FFTW_DIR}/bin)
+    if(WIN32)
+        acmake_append_runtime_dirs(${target} ${FFTW_DIR}/bin)
+    endif()
 
 endmacro()
@@ -0,0 +1,77 @@
+/**
+ * @file cpu_dispatch.h
+ * @brief kernelָѡ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef CPU_DISPATCH_H__
+#define CPU_DISPATCH_H__
+
+#include "global.h"
+
+#include <string>
+
+namespace smfe
+{
+/**
+ * @defgroup cpudispatch cpu-dispatch
+ *
+ * еȵ(Լ, ֱͼ, Ԫת, Ƶ׷ֵ, ֵ˲)ÿһָ
+ * һʵ, ͬһ. ʱcpuֵָ֧, ѡһkernel,
+ * ͬһļڲ֧AVXĻ.
+ *
+ * ʱѡԱ `SMFE_ISA` (ȡֵΪ `scalar`, `avx2`, `avx512`),
+ * Ҳʱ `set_active_isa` л, ԱȲָͬ.
+ *
+ * @{
+ */
+
+/** ָ, ֵԽʾԽµָ */
+enum CpuIsa {
+    ISA_SCALAR = 0,     /**< ʹָʵ */
+    ISA_AVX2 = 1,       /**< AVX2 + FMA */
+    ISA_AVX512 = 2      /**< AVX-512F */
+};
+
+/** ǰcpu֧, ұ뵽еָ */
+CpuIsa detected_isa();
+
+/** ǰʹõָ */
+CpuIsa active_isa();
+
+/**
+ * @brief лʹõָ
+ *
+ * @note л̰߳ȫ, ֻӦû̼߳ʱ(benchmarkʼ֮ǰ)
+ *
+ * @throw SMFEException  isa > detected_isa()
+ */
+void set_active_isa(CpuIsa isa);
+
+/** ָʱָѡ */
+void reset_active_isa();
+
+/** ָ,  "avx2" */
+const char* isa_name(CpuIsa isa);
+
+/**
+ * @brief Ƶõָ @sa isa_name
+ *
+ * @throw std::invalid_argument ƲһϷָ
+ */
+CpuIsa isa_from_string(const std::string& str);
+
+/** @}*/
+}
+
+#endif // CPU_DISPATCH_H__
+
+/**
+ * @example test_cpu_dispatch.cpp
+ * An example for current module @ref cpudispatch
+ */
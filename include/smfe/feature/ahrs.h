@@ -0,0 +1,135 @@
+/**
+ * @file ahrs.h
+ * @brief ʹamgݹ̬Ԫ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef AHRS_H__
+#define AHRS_H__
+
+#include "../global.h"
+
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup ahrs ahrs
+ *
+ * ̬(Madgwick˲)
+ *
+ * `rotate_amg_mat`, `DeadReckoner` ȽӿҪÿһ֡Ԫ, ֱӴamgеõ:
+ * ǻֵõ̬ı仯, ٶ()ʹ(ű)ͨһݶ½ֵƯ.
+ *
+ * 1.   ǵĵλΪ rad/s, ٶȺʹƵĵλûҪ(֮ǰһ)
+ * 2.   õԪѴϵµתȫϵ(z, űx-zƽ),
+ * ֱΪ `rotate_3dvec`, `rotate_amg_mat` Ĳ
+ * 3.   ٶΪ0ֻ֡, Ϊ0ֻ֡ʹüٶ
+ *
+ * `MadgwickAhrs` һ豸, ÿһ֡ĸ²ڴ. `MadgwickAhrsBank` ͬʱ
+ * 豸, ͬ豸ͬһ֡ݷĴĲͬlaneһ( `active_isa` ѡ
+ * ָ).
+ *
+ * @{
+ */
+
+class MadgwickAhrs
+{
+public:
+    /**
+     * @param delta , λΪ
+     * @param beta ݶ½Ĳ, ԽԽ, Խܵٶȵĸ
+     * @param init_rot ʼ̬, ΪյʱʹõλԪ @pre init_rot.empty() || init_rot.size() == 4
+     */
+    explicit MadgwickAhrs(value_t delta, value_t beta = 0.1, const vec& init_rot = vec());
+
+    /**
+     * @brief һ֡amg @pre amg_v.size() == 9
+     *
+     * @return ֮Ԫ
+     */
+    const vec& update(const vec& amg_v);
+
+    /**
+     * @brief ֡, ÿһ֮֡Ԫ浽rot_matӦ
+     *
+     * rot_mat ĴСѾ 4*amg_mat.n_cols ʱ򲻻·ڴ
+     *
+     * @pre amg_mat.n_rows == 9
+     */
+    void update(const mat& amg_mat, mat& rot_mat);
+
+    /** ֡, ÿһ֮֡Ԫ */
+    mat update(const mat& amg_mat);
+
+    /** ǰ̬Ԫ */
+    const vec& rotation() const { return rot_; }
+
+    /** صָ̬, ΪյʱʹõλԪ */
+    void reset(const vec& rot = vec());
+
+    value_t beta() const { return beta_; }
+    void set_beta(value_t beta) { beta_ = beta; }
+
+private:
+    value_t delta_;
+    value_t beta_;
+    vec rot_;
+};
+
+class MadgwickAhrsBank
+{
+public:
+    /**
+     * @param n_devices 豸 @pre n_devices > 0
+     * @param delta 豸ͬĲ
+     * @param beta ݶ½Ĳ @sa MadgwickAhrs
+     */
+    MadgwickAhrsBank(int n_devices, value_t delta, value_t beta = 0.1);
+
+    int n_devices() const { return n_devices_; }
+
+    /**
+     * @brief 豸һ֡
+     *
+     * @param amg_frames iΪi豸amg֡ @pre amg_frames.n_rows == 9 && amg_frames.n_cols == n_devices
+     * @param rot_frames iΪi豸֮Ԫ, СԵʱ·
+     */
+    void update(const mat& amg_frames, mat& rot_frames);
+
+    /**
+     * @brief 豸Ķ֡
+     *
+     * @param amg_mats ÿһ豸 9*n_frames , 豸֡ͬ @pre amg_mats.size() == n_devices
+     * @param rot_mats ÿһ豸ÿһ֮֡Ԫ
+     */
+    void update(const std::vector<mat>& amg_mats, std::vector<mat>& rot_mats);
+
+    /** device豸ǰ̬ */
+    vec rotation(int device) const;
+
+    /** 豸صλԪ */
+    void reset();
+
+private:
+    int n_devices_;
+    value_t delta_;
+    value_t beta_;
+    std::vector<value_t> q_;        /**< ֿŵԪ, ÿһ n_devices  */
+    mat amg_frames_;                /**< ֡ʱһ֡ */
+};
+
+/** @}*/
+}
+
+#endif // AHRS_H__
+
+/**
+ * @example test_ahrs.cpp
+ * An example for current module @ref ahrs
+ */
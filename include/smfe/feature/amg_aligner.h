@@ -0,0 +1,124 @@
+/**
+ * @file amg_aligner.h
+ * @brief ʱ벢زamg
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef AMG_ALIGNER_H__
+#define AMG_ALIGNER_H__
+
+#include "../global.h"
+#include "../sensor_global.h"
+
+#include <deque>
+
+namespace smfe
+{
+/**
+ * @defgroup amgaligner amg-aligner
+ *
+ * ʱ벢زamg
+ *
+ * ӿڶǵȼ(`velocity`, `distance` ʹһ delta), ʵ豸
+ * ʱж, ٶȼ, ƺǵĲƵҲͬ. `AmgAligner` ֱÿһ
+ * ʱ, ֵõΪ delta  9*n amg.
+ *
+ * 1.   һ֡ʱΪʹõĴһʱֵ
+ * 2.   ԲֵֻҪĿʱ֮һ, βֵ(ֶHermite, бʹݵ
+ *      , ʱԲ)Ҫ֮, ÿһֵֻõļ,
+ *      Ҫ¼
+ * 3.   ֮ĴҪ, ӦΪ0
+ *
+ * ݿ԰ĿС, һͬ.
+ *
+ * @{
+ */
+
+enum ResampleMethod {
+    LINEAR_RESAMPLE,
+    CUBIC_RESAMPLE
+};
+
+class AmgAligner
+{
+public:
+    /**
+     * @param delta ݵʱ @pre delta > 0
+     * @param channels ʹõĴ @sa ChannelMask @pre channels != 0
+     * @param method ֵ
+     */
+    explicit AmgAligner(value_t delta, int channels = AmgMask, ResampleMethod method = CUBIC_RESAMPLE);
+
+    /**
+     * @brief һ, ֮Ĵݱ
+     *
+     * @param type  @pre typeΪAcce, MagGyro
+     * @param time ʱ @pre ֮ǰʱ
+     * @param v  @pre v.size() == 3
+     */
+    void push(ChannelType type, value_t time, const vec& v);
+
+    /** һĶ, dataÿһΪһ @sa push */
+    void push(ChannelType type, const vec& times, const mat& data);
+
+    /**
+     * @brief õдݶѾ㹻ֵ֡
+     *
+     * @param amg_mat 9*n amg
+     * @param times ÿһ֡ʱ
+     *
+     * @return ֡n
+     */
+    index_t pull(mat& amg_mat, vec& times);
+
+    /**
+     * @brief ݽ֮õʣµ֡
+     *
+     * ٵȴ֮, ÿһһʱ֡, ββֵʹ
+     * б.
+     */
+    index_t flush(mat& amg_mat, vec& times);
+
+    /** Ѿ֡ */
+    index_t n_frames() const { return n_frames_; }
+
+    /** ݸ */
+    index_t n_buffered(ChannelType type) const { return streams_[type].size(); }
+
+    void clear();
+
+private:
+    struct Sample {
+        value_t time;
+        value_t v[3];
+    };
+    typedef std::deque<Sample> Stream;
+
+    index_t emit(bool final, mat& amg_mat, vec& times);
+    bool ready(const Stream& s, value_t t, bool final) const;
+    void interpolate(const Stream& s, value_t t, value_t* out) const;
+
+    value_t delta_;
+    int channels_;
+    ResampleMethod method_;
+
+    Stream streams_[3];
+    bool started_;
+    value_t start_time_;
+    index_t n_frames_;
+};
+
+/** @}*/
+}
+
+#endif // AMG_ALIGNER_H__
+
+/**
+ * @example test_amg_aligner.cpp
+ * An example for current module @ref amgaligner
+ */
@@ -0,0 +1,118 @@
+/**
+ * @file calibration.h
+ * @brief amgУ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef CALIBRATION_H__
+#define CALIBRATION_H__
+
+#include "../sensor_global.h"
+
+#include <istream>
+
+#include <boost/property_tree/ptree_fwd.hpp>
+
+namespace smfe
+{
+/**
+ * @defgroup calibration calibration
+ *
+ * amgУ
+ *
+ * ÿһʹһ3x3MһƫbУ: v' = M * (v - b)
+ *
+ * 1.   ٶȺ: bΪƫ, MΪ̶Ӻ䲻
+ * 2.   : bΪӲŸ, MΪŸŵ
+ *
+ * `calibrate_rotate_amg_mat` תkernelУת, ԭʼֻҪһξ͵õȫ
+ * У֮, ҪȵõһУ֮amg.
+ *
+ * УԴļжȡ(infoʽ), ûõĴУ:
+ *
+ * @code
+ * acce
+ * {
+ *     matrix "1.01 0 0 0 0.99 0 0 0 1"
+ *     offset "0.02 -0.01 0.05"
+ * }
+ * mag
+ * {
+ *     offset "12.5 -3.1 40.2"
+ * }
+ * @endcode
+ *
+ * @{
+ */
+
+class CalibrationModel
+{
+public:
+    /** дУ */
+    CalibrationModel();
+
+    /**
+     * @brief һУ
+     *
+     * @param type  @pre typeΪAcce, MagGyro
+     * @param matrix У @pre matrixΪ3x3
+     * @param offset ƫ @pre offset.size() == 3
+     */
+    void set(ChannelType type, const mat& matrix, const vec& offset);
+
+    mat matrix(ChannelType type) const;
+    vec offset(ChannelType type) const;
+
+    /** Уһ֡amg @pre amg_v.size() == 9 */
+    vec apply(const vec& amg_v) const;
+
+    /** Уamgÿһ֡ @pre amg_mat.n_rows == 9 */
+    mat apply(const mat& amg_mat) const;
+
+    /** a, m, g˳, ÿһΪдŵMb, 36 */
+    const value_t* data() const { return params_; }
+
+    /**
+     * @brief жȡ, ÿһΪ acce, mag, gyro
+     *
+     * matrixΪ9е, offsetΪ3, ʹÿհ׷ָ. ûõʹõλ0ƫ,
+     * ʽʱ׳std::logic_error
+     */
+    static CalibrationModel from_ptree(const boost::property_tree::ptree& config);
+
+    /** infoʽжȡ @sa from_ptree */
+    static CalibrationModel from_config(std::istream& is);
+
+private:
+    value_t params_[36];
+};
+
+/**
+ * @brief calibrate_rotate_amg_mat У֮תamg, ֻһ @sa rotate_amg_channels
+ *
+ * @pre amg_mat.n_rows == 9 && rot_mat.n_rows == 4 && rot_mat.n_cols == amg_mat.n_cols
+ *
+ * @param model У
+ * @param rot_mat Ӧÿһ֡µԪ
+ * @param amg_mat ԭʼamg
+ * @param channels ҪĴ @sa ChannelMask
+ *
+ * @return ȫµ, Ϊ 3*channel_count(channels), a, m, g˳򱣴ѡĴ
+ */
+mat calibrate_rotate_amg_mat(const CalibrationModel& model, const mat& rot_mat, const mat& amg_mat,
+                             int channels = AmgMask);
+
+/** @}*/
+}
+
+#endif // CALIBRATION_H__
+
+/**
+ * @example test_calibration.cpp
+ * An example for current module @ref calibration
+ */
@@ -0,0 +1,111 @@
+/**
+ * @file cepstral_features.h
+ * @brief MFCCĵ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef CEPSTRAL_FEATURES_H__
+#define CEPSTRAL_FEATURES_H__
+
+#include "../global.h"
+
+namespace smfe
+{
+/**
+ * @defgroup cepstralfeatures cepstral-features
+ *
+ * 
+ *
+ * ̺еMFCCͬ:
+ *
+ * 1.   ÿһڵĹ(ֵƽ, ֵ `frequency_magnitude_vec` ͬ)
+ * 2.   ʹһ˲õÿһƵ, ȡ
+ * 3.   DCT, ǰɸϵ
+ *
+ * ˲DCTֻʹڳ, ƵԼй, ڹʱ. һ
+ * ʱ, дڵƵʹfft, һξ˷.
+ *
+ * ˲ƵʿԷֲ, Ҳ԰melƵĶ̶ȷֲ:
+ *
+ *      warp(f) = log(1 + f / corner_fre)
+ *
+ *  corner_fre Ϊ700Hz. ˶źŵƵһ20Hz, ҪʹøС corner_fre,
+ * ƵֲŻиߵķֱ, ĬֵΪ2Hz.
+ *
+ * @{
+ */
+
+/** ˲Ƶʵķֲʽ */
+enum FilterBankScale {
+    LINEAR_FILTER_BANK,     /**< ƵϾȷֲ */
+    MEL_FILTER_BANK         /**<  log(1 + f/corner_fre) Ͼȷֲ */
+};
+
+class CepstralFeatures
+{
+public:
+    /**
+     * @param window_size ڳ @pre window_size > 1
+     * @param fs Ƶ
+     * @param n_filters ˲ @pre n_filters > 0
+     * @param n_coefficients ĵϵ @pre 0 < n_coefficients <= n_filters
+     * @param scale ˲Ƶʵķֲʽ
+     * @param corner_fre mel̶ȵתƵ, ֻ MEL_FILTER_BANK ʱʹ @pre corner_fre > 0
+     */
+    CepstralFeatures(int window_size, value_t fs, int n_filters, int n_coefficients,
+                     FilterBankScale scale = MEL_FILTER_BANK, value_t corner_fre = 2.0);
+
+    /**
+     * @brief һڵĵϵ
+     *
+     * @param window  @pre window.size() == window_size
+     * @return Ϊ n_coefficients ĵϵ
+     */
+    vec compute(const vec& window) const;
+
+    /**
+     * @brief ڵĵϵ
+     *
+     * @param windows ÿһһڵ @pre windows.n_rows == window_size
+     * @param n_threads Ƶʹõ߳Ŀ @sa smfe_fft_batch
+     *
+     * @return СΪ n_coefficients x windows.n_cols, ÿһǶӦڵĵϵ
+     */
+    mat compute(const mat& windows, int n_threads = 1) const;
+
+    int window_size() const { return window_size_; }
+
+    /** ˲, СΪ n_filters x (window_size/2 + 1) */
+    const mat& filter_bank() const { return filter_bank_; }
+
+    /** DCT, СΪ n_coefficients x n_filters */
+    const mat& dct() const { return dct_; }
+
+private:
+    int window_size_;
+    mat filter_bank_;
+    mat dct_;
+};
+
+/**
+ * @brief һźŵĵϵ @sa CepstralFeatures
+ *
+ * Ҫܶര, Ӧֱʹ `CepstralFeatures`, ˲DCTֻһ
+ */
+vec cepstral_features(const vec& source, value_t fs, int n_filters, int n_coefficients,
+                      FilterBankScale scale = MEL_FILTER_BANK, value_t corner_fre = 2.0);
+
+/** @}*/
+}
+
+#endif // CEPSTRAL_FEATURES_H__
+
+/**
+ * @example test_cepstral_features.cpp
+ * An example for current module @ref cepstralfeatures
+ */
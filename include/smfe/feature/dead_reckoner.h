@@ -0,0 +1,130 @@
+/**
+ * @file dead_reckoner.h
+ * @brief ֡״̬ĺλ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef DEAD_RECKONER_H__
+#define DEAD_RECKONER_H__
+
+#include "../global.h"
+
+#include <climits>
+
+namespace smfe
+{
+/**
+ * @defgroup deadreckoner dead-reckoner
+ *
+ * λ
+ *
+ * `last_velocity_of_amg_vec`, `moving_distance_of_amg_vec`  `rotated_angle_of_amg_vec` 
+ * ״̬, ÿһڶҪʼٶ, ͷ. `DeadReckoner` ٶ, λƺͽǶ,
+ * ÿһ֡amgݺͶӦԪʱO(1)ʱڸ.
+ *
+ * ÿһ֡Ĵ״̬ӿͬ:
+ *
+ * 1.   ʹԪamg֡תȫϵ, ȥȫµ
+ * 2.   ٶȾֵС still_acce_threshold Ϊ0, ĳһ
+ * station_count_threshold ֡Ϊ0ʱ, ϵٶǿΪ0 @sa velocity
+ * 3.   ʹιʽֵõٶ, ٻֵõλ. ݻֵõǶ
+ *
+ * ԰һݷֳ⼸, õٶȺͶݵ `last_velocity_of_amg_vec`
+ * (ʹþֵ˲)ȫͬ. λƺͽǶʹιʽ,  `integration` еĸ߽׹ʽ.
+ *
+ * ʹ `checkpoint` 浱ǰ״̬, ֮ʹ `restore` ص״̬, ͬһ
+ * ԲͬĴ, ڼ⵽֮.
+ *
+ * @{
+ */
+
+class DeadReckoner
+{
+public:
+    /** ȫ״̬, ֱӸ */
+    struct State {
+        value_t velocity[3];
+        value_t position[3];
+        value_t angle[3];
+        value_t last_acce[3];       /**< һ֮֡ȫּٶ */
+        value_t last_gyro[3];       /**< һ֡ȫ */
+        int station_count[3];       /**< ÿһֹ֡ */
+        unsigned long long n_frames;
+    };
+
+    /**
+     * @param delta ֡ʱ
+     * @param init_velocity ʼٶ, Ϊձʾ0 @pre init_velocityΪջ߳Ϊ3
+     * @param still_acce_threshold Ϊ0ļٶֵ @pre still_acce_threshold >= 0
+     * @param station_count_threshold ֡ٶΪ0֮ٶǿΪ0 @pre station_count_threshold > 0
+     * @param gravity ȫµ, Ϊձʾȥ @pre gravityΪջ߳Ϊ3
+     */
+    explicit DeadReckoner(value_t delta,
+                          const vec& init_velocity = vec(),
+                          value_t still_acce_threshold = 0.0,
+                          int station_count_threshold = INT_MAX,
+                          const vec& gravity = vec()
+                         );
+
+    /**
+     * @brief һ֡
+     *
+     * @param rot һ֡ȫµĳ @pre rot.size() == 4
+     * @param amg_v ֲµamg @pre amg_v.size() == 9 @sa pack_amg_vec
+     */
+    void push(const vec& rot, const vec& amg_v);
+
+    /**
+     * @brief δ֡
+     *
+     * @pre rot_mat.n_rows == 4 && amg_mat.n_rows == 9 && rot_mat.n_cols == amg_mat.n_cols
+     */
+    void push(const mat& rot_mat, const mat& amg_mat);
+
+    /** ǰٶ */
+    vec velocity() const;
+
+    /** ӵһ֡ʼλ */
+    vec position() const;
+
+    /** ӵһ֡ʼתĽǶ */
+    vec angle() const;
+
+    /** Ѿ֡ */
+    unsigned long long n_frames() const { return state_.n_frames; }
+
+    /** 浱ǰ״̬ */
+    const State& checkpoint() const { return state_; }
+
+    /** ָ֮ǰ״̬ */
+    void restore(const State& state) { state_ = state; }
+
+    /** صʱ״̬ */
+    void reset();
+
+private:
+    void push(const value_t* rot, const value_t* amg);
+
+    value_t delta_;
+    value_t init_velocity_[3];
+    value_t still_acce_threshold_;
+    int station_count_threshold_;
+    value_t gravity_[3];
+
+    State state_;
+};
+
+/** @}*/
+}
+
+#endif // DEAD_RECKONER_H__
+
+/**
+ * @example test_dead_reckoner.cpp
+ * An example for current module @ref deadreckoner
+ */
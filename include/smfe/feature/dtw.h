@@ -0,0 +1,170 @@
+/**
+ * @file dtw.h
+ * @brief ½֦Ķ̬ʱ(DTW)ģƥ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef DTW_H__
+#define DTW_H__
+
+#include "../global.h"
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup dtw dtw
+ *
+ * ̬ʱ
+ *
+ * ʹúamgͬĴŷʽ: ÿһһ֡, ÿһһͨ(ٶȵ3,
+ * 9amg), amg `unpack_amg_mat` ĽֱΪ.
+ * ֮֡ľֵͨƽ, DTWŹ·֡ĺ(ûп).
+ *
+ * ֻۼƴ, ڴΪO(ģ峤). ·Sakoe-Chiba:
+ * iֻ֡ܺ͵ [i-band, i+band] ֡Ӧ, bandСг֮ʱʹó֮.
+ *
+ * `DtwMatcher` ںܶģѰƵһ, մ۴ӵ͵ʹķ
+ * õģ:
+ *
+ * 1.   LB_Kim: β֡һ·, ʱ
+ * 2.   LB_Keogh: ģbandе°, ʱ, ֻԳȺģͬʹ
+ * 3.   early abandoning: DTWĳһСۼƴѾǰŵʱֹͣ
+ *
+ * ο: T. Rakthanmanon et al., Searching and Mining Trillions of Time Series
+ * Subsequences under Dynamic Time Warping, KDD 2012
+ *
+ * @{
+ */
+
+/**
+ * @brief еDTW
+ *
+ * @param a, b , ÿһһ֡ @pre a.n_rows == b.n_rows
+ * @param band Sakoe-Chibaİ뾶, ʾ
+ * @param abandon_above ۼƴһֵʱֹͣ
+ *
+ * @return DTW, abandon_above
+ */
+value_t dtw_distance(const mat& a, const mat& b, int band = -1,
+                     value_t abandon_above = std::numeric_limits<value_t>::infinity());
+
+/** ͨеDTW @sa dtw_distance */
+value_t dtw_distance(const vec& a, const vec& b, int band = -1,
+                     value_t abandon_above = std::numeric_limits<value_t>::infinity());
+
+/**
+ * @brief LB_Kim½: β֡ľ֮
+ *
+ * @pre a.n_rows == b.n_rows, жΪ
+ */
+value_t lb_kim(const mat& a, const mat& b);
+
+/**
+ * @brief Sakoe-Chibaÿһͨ°
+ *
+ * lower(c, i) = min(series(c, [i-band, i+band])), upperͬ
+ */
+void dtw_envelope(const mat& series, int band, mat& lower, mat& upper);
+
+/**
+ * @brief LB_Keogh½: queryģ֮ⲿֵƽ
+ *
+ * @pre queryͰĴСͬ
+ */
+value_t lb_keogh(const mat& query, const mat& lower, const mat& upper);
+
+/**
+ * һģѰҺͲѯDTWСģ
+ *
+ * ģİڼʱ. ѯ޸Ķ, ߳̿ͬʱѯ.
+ */
+class DtwMatcher
+{
+public:
+    /** ƥ */
+    struct Match {
+        Match() : index(-1), distance(std::numeric_limits<value_t>::infinity()) {}
+
+        int index;          /**< ģ, ûģʱΪ-1 */
+        value_t distance;   /**< DTW */
+    };
+
+    /** ֦ͳϢ, ڵband */
+    struct Stats {
+        Stats() : kim_pruned(0), keogh_pruned(0), abandoned(0), computed(0) {}
+
+        unsigned long long kim_pruned;      /**< LB_Kimģ */
+        unsigned long long keogh_pruned;    /**< LB_Keoghģ */
+        unsigned long long abandoned;       /**< DTW;ֹͣģ */
+        unsigned long long computed;        /**< DTWģ */
+    };
+
+    /**
+     * @param band Sakoe-Chibaİ뾶, ʾ @sa dtw_distance
+     */
+    explicit DtwMatcher(int band = -1);
+
+    /**
+     * @brief һģ
+     *
+     * @pre ģ岻Ϊ, ֮ͨǰģͬ
+     * @return ģ
+     */
+    int add_template(const mat& pattern);
+
+    int n_templates() const { return templates_.size(); }
+
+    const mat& get_template(int index) const { return templates_[index].series; }
+
+    /**
+     * @brief ѰҺqueryƵģ
+     *
+     * @param query ѯ @pre query.n_rows ģͨͬ
+     * @param n_threads ģ屻ƽΪn_threads, ÿһڵ߳в, ̹߳ǰ
+     * Сľڼ֦ @pre n_threads >= 1
+     * @param stats ΪյʱۼӼ֦ͳϢ, ߳ʱ֦ĸ̵ִ߳˳й
+     *
+     * ͬʱ򷵻Сģ, ߳޹
+     */
+    Match best_match(const mat& query, int n_threads = 1, Stats* stats = nullptr) const;
+
+    /**
+     * @brief һѯֱѰƵģ
+     *
+     * ѯƽΪn_threads, ÿһڵ߳β
+     */
+    std::vector<Match> best_matches(const std::vector<mat>& queries, int n_threads = 1,
+                                    Stats* stats = nullptr) const;
+
+private:
+    struct Template {
+        mat series;
+        mat lower;
+        mat upper;
+    };
+
+    void search(const mat& query, int first, int last, std::atomic<value_t>* shared_best,
+                Match& best, Stats& stats) const;
+
+    int band_;
+    std::vector<Template> templates_;
+};
+
+/** @}*/
+}
+
+#endif // DTW_H__
+
+/**
+ * @example test_dtw.cpp
+ * An example for current module @ref dtw
+ */
@@ -4,7 +4,7 @@
 * @author whiledoing (lovingwhile@gmail.com)
 * @date 2013-07-17
 *
-* Ҫʹarma::fftпٸҶ任
+* ʹfftwпٸҶ任, ÿһȵļƻֻһ @sa fftconfig
 */
 
 #ifdef _MSC_VER
@@ -97,6 +97,42 @@ typedef std::vector<FrequencyMagnitude> fm_vec;
  */
 cx_vec smfe_fft(const vec& source);
 
+/**
+ * @brief źź油0n_fft֮Ƶ
+ *
+ * @pre n_fft >= source.size()
+ */
+cx_vec smfe_fft(const vec& source, int n_fft);
+
+/**
+ * @brief Ծÿһмfft
+ *
+ * ÿһһ(һͨ), ʹͬһfftwƻ, ȶÿһ
+ *  `smfe_fft` ܶ.
+ *
+ * @param windows ÿһһͬ
+ * @param n_threads м߳Ŀ, 1ʾڵǰ߳м @pre n_threads >= 1
+ *
+ * @return СΪ (windows.n_rows/2 + 1) x windows.n_cols, ÿһΪӦƵ׵ķǸƵʲ,
+ * 
+ */
+cx_mat smfe_fft_batch(const mat& windows, int n_threads = 1);
+
+/**
+ * @brief ԾÿһмƵ׵ķֵ
+ *
+ * iжӦƵΪ i*fs/windows.n_rows, ÿһкͶһе `frequency_magnitude_vec`
+ * õķֵͬ @sa smfe_fft_batch
+ *
+ * @return СΪ (windows.n_rows/2 + 1) x windows.n_cols
+ */
+mat frequency_magnitude_mat(const mat& windows, int n_threads = 1);
+
+/**
+ * @brief СnС 2^a * 3^b * 5^c * 7^d, ֳȵfft
+ */
+int fft_fast_size(int n);
+
 /**
  * Ƶ׼ԭʼź
  */
@@ -122,6 +158,20 @@ fm_vec frequency_magnitude_vec(const vec& source, value_t fs);
 */
 fm_vec frequency_magnitude_vec(const cx_vec& spectrum, value_t fs);
 
+/**
+* @brief 0֮<b>Ƶ-ֵ</b>Ϣ
+*
+* ȳȵfftȽ, 0һĳ֮ټ. ƵʵļΪ `fs/n_fft`,
+* ֵԭʼźŵĳȹһ, ƵʵϵźŵõķֵͲ0ʱͬ.
+*
+* @param source ԭʼź
+* @param fs Ƶ
+* @param n_fft fftĳ, 0ʾʹ `fft_fast_size(source.size())` @pre n_fft == 0 || n_fft >= source.size()
+*
+* @return Ϊ n_fft/2 + 1 <b>Ƶ-ֵ</b>, ƵʴС˳
+*/
+fm_vec padded_frequency_magnitude_vec(const vec& source, value_t fs, int n_fft = 0);
+
 /**
  *	õǰ<b>Ƶ-ֵ</b>еƵʷ, packΪһ
  */
@@ -0,0 +1,75 @@
+/**
+ * @file gyro_integration.h
+ * @brief ʹԪ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef GYRO_INTEGRATION_H__
+#define GYRO_INTEGRATION_H__
+
+#include "../global.h"
+
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup gyrointegration gyro-integration
+ *
+ * ǵԪ
+ *
+ * `rotated_angle_of_amg_vec` amgתȫϵ֮, ǵÿһֱ.
+ * תǲɽ, ֱõĽǶȲܱʾĳ, ҼٶȺʹƵת
+ * ûõ.
+ *
+ * ÿһ֡ݵõһԪ, ͵ǰĳ:
+ *
+ * q(i+1) = q(i) * exp(w * delta / 2),  w Ϊ֡ݵƽֵ(λ rad/s)
+ *
+ * ֻݱתȫϵ, ÿһֻ֡תһ3d.
+ *
+ * @{
+ */
+
+/**
+ * ǻֵĽ
+ */
+struct GyroIntegration {
+    vec rotation;       /**< һ֡ȫµĳ */
+    vec angle;          /**< ȫתĽǶ, ʹιʽ */
+    value_t total_angle;    /**< ÿһ֡תǶȵľֵ֮ */
+};
+
+/**
+ * @brief init_rotʼ
+ *
+ * @param amg_mat ֲϵµamg, ֻʹǲ @pre amg_mat.n_rows == 9
+ * @param delta ֡ʱ
+ * @param init_rot һ֡ĳ, ΪյʱʹõλԪ @pre init_rot.empty() || init_rot.size() == 4
+ */
+GyroIntegration integrate_gyro(const mat& amg_mat, value_t delta, const vec& init_rot = vec());
+
+/**
+ * @brief Զڷֱ, ÿһڶinit_rotʼ @sa integrate_gyro
+ *
+ * @param windows ÿһڵβ֡() @pre windows[i].second < amg_mat.n_cols
+ * @param n_threads м߳Ŀ, 1ʾڵǰ߳м @pre n_threads >= 1
+ */
+std::vector<GyroIntegration> integrate_gyro_windows(const mat& amg_mat, const index_pair_vec& windows,
+                                                    value_t delta, const vec& init_rot = vec(),
+                                                    int n_threads = 1);
+
+/** @}*/
+}
+
+#endif // GYRO_INTEGRATION_H__
+
+/**
+ * @example test_gyro_integration.cpp
+ * An example for current module @ref gyrointegration
+ */
@@ -0,0 +1,123 @@
+/**
+ * @file histogram_entropy.h
+ * @brief ֱͼϢصԼ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef HISTOGRAM_ENTROPY_H__
+#define HISTOGRAM_ENTROPY_H__
+
+#include "../global.h"
+
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup histogramentropy histogram-entropy
+ *
+ * Ϣصļ @sa entropy
+ *
+ * 1.   `HistogramEntropy` һظʹõֱͼ, Զͨ߶
+ * ϢصʱҪ·ڴ. ֻҪһαõСֵ, һαͳ
+ * ֱͼ(x86ʹSSE2ָ), ÿһֻҪһγ˷ǳ.
+ * 2.   `SlidingEntropy` ڻ, ֱͼڹʱ̶, ÿμһֻҪ
+ * ļ, õϢصĴΪO(1).
+ *
+ * @{
+ */
+
+class HistogramEntropy
+{
+public:
+    /**
+     * @param nbins ֱͼ, Χ[1, +inf)
+     */
+    explicit HistogramEntropy(int nbins);
+
+    int nbins() const { return nbins_; }
+
+    /** Ϣ,  entropy(source, nbins) һ @pre source.size() > 0 */
+    value_t operator()(const vec& source);
+
+    /** һݵϢ @pre n > 0 */
+    value_t operator()(const value_t* data, index_t n);
+
+    /**
+     * @brief Ϣ
+     *
+     * @param windows ÿһΪһͨһڵ
+     *
+     * @return ÿһݶӦϢ
+     */
+    vec operator()(const mat& windows);
+
+    /** һμֱͼ */
+    const std::vector<int>& histogram() const { return count_; }
+
+private:
+    int nbins_;
+    std::vector<int> count_;
+};
+
+class SlidingEntropy
+{
+public:
+    /**
+     * @param window_size ڴС @pre window_size > 0
+     * @param nbins ֱͼ @pre nbins > 0
+     * @param min_v ֱͼ½
+     * @param max_v ֱͼϽ @pre max_v > min_v
+     *
+     * @note  entropy ͬ, ½ǹ̶, Ŵеݱ仯. 
+     * [min_v, max_v] ΧݱͳƵһһ.
+     */
+    SlidingEntropy(int window_size, int nbins, value_t min_v, value_t max_v);
+
+    /** һ, , ͬʱƳ */
+    void push(value_t value);
+
+    /** μһ */
+    void push(const vec& data);
+
+    /** մ */
+    void clear();
+
+    /** ݵĸ */
+    index_t size() const { return count_in_window_; }
+
+    /** ǰݵϢ */
+    value_t entropy() const;
+
+    /** ǰڵֱͼ */
+    const std::vector<int>& histogram() const { return count_; }
+
+private:
+    int bin_of(value_t value) const;
+
+    int nbins_;
+    value_t min_v_;
+    value_t inv_bin_size_;
+
+    std::vector<int> bins_;          /**< յ˳򱣴ÿһڵ */
+    std::vector<int> count_;
+    std::vector<value_t> c_log_c_;   /**< Ԥȼõ c*log2(c), cķΧ[0, window_size] */
+    value_t sum_c_log_c_;
+    index_t head_;
+    index_t count_in_window_;
+};
+
+/** @}*/
+}
+
+#endif // HISTOGRAM_ENTROPY_H__
+
+/**
+ * @example test_statistics_features.cpp
+ * An example for current module @ref histogramentropy
+ */
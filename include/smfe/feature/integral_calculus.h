@@ -44,6 +44,51 @@ value_t integration(vec const& data, int degree = 2);
  */
 value_t integration(vec const& data, vec const& delta_vec);
 
+/**
+ *	ۻ, õÿһݵϵֵ(Ӽٶȵõٶÿһʱ̵ֵ)
+ *
+ *	1.	res[0]Ϊinit, res[i]Ϊinitϴӵ0ݵiݵĻ
+ *	2.	ÿһʹ\c degreeݲֵĶʽ. \c degreeΪ2ʱΪιʽ, Ϊ3ʱ
+ *	ʹ˺һ, Ϊ4ʱʹ. û㹻ݵʹõ.
+ *	3.	\c integrationͬ, е䶼. \c degreeΪ2ʱһ
+ *	integration(data, 2) * delta ͬ()
+ *
+ *	@param data 
+ *	@param delta ֮ļ
+ *	@param degree ֵʹõݸ, ݸdegreeʱʹýϵ͵Ľ
+ *	@param init ֵĳʼֵ
+ *
+ *	@pre degreeķΧΪ[2,4], dataΪ
+ */
+vec cumulative_integration(vec const& data, value_t delta = 1.0, int degree = 2, value_t init = 0.0);
+
+/**
+ *	ǵȼݵۻ @sa cumulative_integration
+ *
+ *	delta_vecĺ integration(data, delta_vec) ͬ, \c degreeΪ2ʱһȫͬ.
+ *	ֵʽĽڵʹʵʵļ.
+ *
+ *	@pre data.size() == delta_vec.size() + 1, degreeķΧΪ[2,4]
+ */
+vec cumulative_integration(vec const& data, vec const& delta_vec, int degree = 2, value_t init = 0.0);
+
+/**
+ *	Ծÿһԭؼۻ, ÿһеĳʼֵΪ0 @sa cumulative_integration
+ *
+ *	9*namgеļٶֱӱΪٶ, Ҫÿһ.
+ */
+void cumulative_integration_rows(mat& data, value_t delta = 1.0, int degree = 2);
+
+/**
+ *	ۻ, һεõõٶȺλƵĹ켣 @sa cumulative_integration
+ *
+ *	@param data (ٶ)
+ *	@param first һλֵĽ(ٶ)
+ *	@param second λֵĽ(λ)
+ */
+void cumulative_trajectory(vec const& data, vec& first, vec& second, value_t delta = 1.0, int degree = 2,
+						   value_t init_first = 0.0, value_t init_second = 0.0);
+
 }
 
 #endif // INTEGRAL_CALCULUS_H__
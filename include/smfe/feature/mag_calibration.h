@@ -0,0 +1,103 @@
+/**
+ * @file mag_calibration.h
+ * @brief ߹ƴƵӲźŸ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef MAG_CALIBRATION_H__
+#define MAG_CALIBRATION_H__
+
+#include "../global.h"
+
+namespace smfe
+{
+class CalibrationModel;
+
+/**
+ * @defgroup magcalibration mag-calibration
+ *
+ * Ƶ
+ *
+ * ûиŵʱ, Ƶݷֲһ. ӲŸʹƫ, ŸŰΪ.
+ * ʹС
+ *
+ * a*x^2 + b*y^2 + c*z^2 + 2d*xy + 2e*xz + 2f*yz + 2g*x + 2h*y + 2i*z = 1
+ *
+ * õ(Ӳƫ)ͰĶԳƾ(), У֮İ뾶Ϊ
+ * ļƽֵ.
+ *
+ * ÿһֻ· 9x9 ͳ, Ѿ޹, Ҫʷ.
+ *  `solve` ʱ. ʹӵʱɵȨذָ˥, ʺΧų
+ * 仯ĳʱ.
+ *
+ * @{
+ */
+
+class MagCalibrationEstimator
+{
+public:
+    /**
+     * @param forgetting , ÿһ֮ǰͳ, 1ʾ
+     * @pre 0 < forgetting <= 1
+     */
+    explicit MagCalibrationEstimator(value_t forgetting = 1.0);
+
+    /** һ @pre mag.size() == 3 */
+    void push(const vec& mag);
+
+    /** amgÿһ֡Ĵ @pre amg_mat.n_rows == 9 */
+    void push_amg(const mat& amg_mat);
+
+    /**  */
+    unsigned long long n_samples() const { return n_samples_; }
+
+    /**
+     * @brief ʹõǰͳ
+     *
+     * (9)߷ֲһƽ, ϵĽʱʧ,
+     * ʱһγɹĽ
+     *
+     * @return Ƿɹ
+     */
+    bool solve();
+
+    /** һγɹϵӲƫ, ûгɹʱΪ0 */
+    const vec& offset() const { return offset_; }
+
+    /** һγɹϵ, ûгɹʱΪλ */
+    const mat& matrix() const { return matrix_; }
+
+    /** У֮İ뾶 */
+    value_t radius() const { return radius_; }
+
+    /** һϵĽΪmodelдƵУ @sa CalibrationModel */
+    void apply_to(CalibrationModel& model) const;
+
+    /** ͳ, һϵĽ */
+    void reset();
+
+private:
+    value_t forgetting_;
+    value_t normal_[9][9];      /**<  D^T D ǲ */
+    value_t rhs_[9];            /**< D^T 1 */
+    unsigned long long n_samples_;
+
+    vec offset_;
+    mat matrix_;
+    value_t radius_;
+};
+
+/** @}*/
+}
+
+#endif // MAG_CALIBRATION_H__
+
+/**
+ * @example test_mag_calibration.cpp
+ * An example for current module @ref magcalibration
+ */
@@ -0,0 +1,96 @@
+/**
+ * @file moment_accumulator.h
+ * @brief һαֵ, , ƫȺͷ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef MOMENT_ACCUMULATOR_H__
+#define MOMENT_ACCUMULATOR_H__
+
+#include "../global.h"
+
+namespace smfe
+{
+/**
+ * @defgroup momentaccumulator moment-accumulator
+ *
+ * ɺϲľۼ
+ *
+ * ʹ Welford / Terriberry 㷨ۼӵ4׵ľ, ֵȶ, Ҫ.
+ * ۼʹ Pbay Ĺʽϲ, һκܳźſԷֿ(߷߳)ۼ,
+ * ϲõһαͬĽ.
+ *
+ * ο: P. Pbay, Formulas for Robust, One-Pass Parallel Computation of Covariances and
+ * Arbitrary-Order Statistical Moments, SAND2008-6212
+ *
+ * @{
+ */
+
+class MomentAccumulator
+{
+public:
+    MomentAccumulator();
+
+    /** һ */
+    void update(value_t value);
+
+    /** μһ */
+    void update(const vec& data);
+
+    /** ϲһۼĽ */
+    void merge(const MomentAccumulator& other);
+
+    /** Ѿݸ */
+    unsigned long long count() const { return n_; }
+
+    /** ֵ */
+    value_t mean() const { return mean_; }
+
+    /**
+     * 
+     *
+     * @param norm_type  arma::var һ, 0ʾʹN-1, 1ʾʹN
+     */
+    value_t var(int norm_type = 0) const;
+
+    /** ׼ @sa var */
+    value_t stddev(int norm_type = 0) const;
+
+    /** ƫ,  skewness һ @sa skewness */
+    value_t skewness() const;
+
+    /** (ȥ3),  kurtosis һ @sa kurtosis */
+    value_t kurtosis() const;
+
+private:
+    unsigned long long n_;
+    value_t mean_;
+    value_t m2_;    /**< 2ľ֮ */
+    value_t m3_;    /**< 3ľ֮ */
+    value_t m4_;    /**< 4ľ֮ */
+};
+
+/**
+ * @brief һݵľ
+ *
+ * ݱƽΪn_threads, ÿһڵ߳ۼ, ϲ
+ *
+ * @param source 
+ * @param n_threads ʹõ߳Ŀ, 1ʾڵǰ߳м @pre n_threads >= 1
+ */
+MomentAccumulator accumulate_moments(const vec& source, int n_threads = 1);
+
+/** @}*/
+}
+
+#endif // MOMENT_ACCUMULATOR_H__
+
+/**
+ * @example test_moment_accumulator.cpp
+ * An example for current module @ref momentaccumulator
+ */
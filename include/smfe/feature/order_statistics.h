@@ -0,0 +1,157 @@
+/**
+ * @file order_statistics.h
+ * @brief һõ˳ͳ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef ORDER_STATISTICS_H__
+#define ORDER_STATISTICS_H__
+
+#include "../global.h"
+
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup orderstatistics order-statistics
+ *
+ * ˳ͳ
+ *
+ * `first_quater`, `third_quater`, `median`, `quartile_deviation` Ƚӿÿεö´һ
+ * ݲһ `nth_element`. ͬһҪ˳ͳ, ʹñģ:
+ *
+ * 1.   `OrderStatistics` һڵֻһ, ֮еĲѯO(1)
+ * 2.   `RollingOrderStatistics` ڻ, ÿμһ(Ƴɵ)
+ * ֻҪһζֲҺһξֲƶ, Ҫ
+ *
+ * нӿڵĽ `get_nth_elem`, `first_quater`, `third_quater`, `median` һ.
+ *
+ * @{
+ */
+
+/**
+ * @brief һݵ˳ͳ
+ *
+ * ʱ򿽱һ, ֮еĲѯ޸
+ */
+class OrderStatistics
+{
+public:
+    /**
+     * @param source ԭʼ<b>ûо</b> @pre source.size() > 0
+     */
+    explicit OrderStatistics(const vec& source);
+
+    /** ݵĸ */
+    index_t size() const { return sorted_.size(); }
+
+    /** Сź */
+    const vec& sorted() const { return sorted_; }
+
+    /** nСԪ,  get_nth_elem һ @pre 0 <= nth < size() */
+    value_t nth(int nth) const;
+
+    value_t min() const;
+    value_t max() const;
+
+    /** ֵ, ݸΪżʱȡмֵľֵ,  arma::median һ */
+    value_t median() const;
+
+    /** 1/4СԪ @sa first_quater */
+    value_t first_quater() const;
+
+    /** 3/4СԪ @sa third_quater */
+    value_t third_quater() const;
+
+    /** ķλֵ @sa quartile_deviation */
+    value_t quartile_deviation() const;
+
+    /**
+     * @brief λ, ˳ͳ֮ʹԲֵ
+     *
+     * @param p λλ, Χ[0, 1], 0ӦСֵ, 1Ӧֵ
+     */
+    value_t quantile(value_t p) const;
+
+    /**
+     * @brief ٷλ @sa quantile
+     *
+     * @param percent ٷֱ, Χ[0, 100]
+     */
+    value_t percentile(value_t percent) const;
+
+private:
+    vec sorted_;
+};
+
+/**
+ * @brief µ˳ͳ
+ *
+ * ڲһյ˳ŵĻλ, һʼݻ. ÿμһʱ,
+ * Ѿ, Ƴľݺ֮ƶһλ, Ը´Ϊ
+ * O(log(n)) ĲҼ򻺳еľ, ѯΪO(1).
+ *
+ * в·ڴ.
+ */
+class RollingOrderStatistics
+{
+public:
+    /**
+     * @param window_size ڵĴС @pre window_size > 0
+     */
+    explicit RollingOrderStatistics(int window_size);
+
+    /** һ, , ͬʱƳ */
+    void push(value_t value);
+
+    /** μһ */
+    void push(const vec& data);
+
+    /** մ */
+    void clear();
+
+    /** еǰݵĸ */
+    index_t size() const { return count_; }
+
+    /** ڵĴС */
+    index_t window_size() const { return arrival_.size(); }
+
+    /** ǷѾ */
+    bool full() const { return count_ == arrival_.size(); }
+
+    /** дСź */
+    vec sorted() const;
+
+    /** ²ѯ OrderStatistics һ @pre size() > 0 */
+    value_t nth(int nth) const;
+    value_t min() const;
+    value_t max() const;
+    value_t median() const;
+    value_t first_quater() const;
+    value_t third_quater() const;
+    value_t quartile_deviation() const;
+    value_t quantile(value_t p) const;
+    value_t percentile(value_t percent) const;
+
+private:
+    std::vector<value_t> arrival_;  /**< յ˳򱣴Ļλ */
+    std::vector<value_t> sorted_;   /**< 򻺳, ֻǰcount_Ч */
+    index_t head_;                  /**< λݵλ */
+    index_t count_;
+};
+
+/** @}*/
+}
+
+#endif // ORDER_STATISTICS_H__
+
+/**
+ * @example test_order_statistics.cpp
+ * An example for current module @ref orderstatistics
+ */
@@ -0,0 +1,141 @@
+/**
+ * @file peak_zero_crossing_detector.h
+ * @brief ʽķֵ͹
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef PEAK_ZERO_CROSSING_DETECTOR_H__
+#define PEAK_ZERO_CROSSING_DETECTOR_H__
+
+#include "../global.h"
+
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup peakzerocrossingdetector peak-zero-crossing-detector
+ *
+ * ʽķֵ͹
+ *
+ * `peak_index`  `zero_crossing_index` ÿһζҪ, ÿƶһ, 󲿷
+ * ļ㶼ظ. `PeakZeroCrossingDetector` ÿֻһµ, ʹ<b>±</b>
+ * (ӵһݿʼ)ʾķֵ͹¼, ͬʱάһ¼ĸ.
+ *
+ * Ķӿһ:
+ *
+ * 1.   ֵ: `abs(x[i]) > abs(x[i-1]) && abs(x[i]) > abs(x[i+1])`, ԵiǷΪֵ
+ * Ҫڵi+1ݵʱȷ
+ * 2.   : `x[i-1] * x[i] <= 0`
+ *
+ * еļͶԴֱӵ `peak_index(window).size()` Լ
+ * `zero_crossing_index(window).size()` Ľͬ. еĻڹʱ, ֮󲻻
+ * ڴ.
+ *
+ * @{
+ */
+
+class PeakZeroCrossingDetector
+{
+public:
+    typedef unsigned long long position_t;  /**< еľ± */
+
+    /** push ص¼־ */
+    enum EventFlag {
+        NO_EVENT = 0,
+        PEAK = 1,           /**< һ(±Ϊ position()-2)Ƿֵ */
+        ZERO_CROSSING = 2   /**< ǰ(±Ϊ position()-1)ǹ */
+    };
+
+    /** һ¼ */
+    struct Event {
+        EventFlag type;
+        position_t index;   /**< ¼ľ± */
+    };
+
+    /**
+     * @param window_size ͳ¼ĴڴС @pre window_size >= 1
+     */
+    explicit PeakZeroCrossingDetector(int window_size);
+
+    /**
+     * @brief һ
+     *
+     * @return ȷ¼, EventFlag 
+     */
+    int push(value_t value);
+
+    /**
+     * @brief μһ, ⵽¼ӵ events ĩβ
+     *
+     * events ڶε֮ظʹ, ·ڴ
+     */
+    void push(const vec& data, std::vector<Event>& events);
+
+    /** ״̬, ±´0ʼ */
+    void clear();
+
+    /** Ѿݸ, Ҳһݵľ± */
+    position_t position() const { return position_; }
+
+    int window_size() const { return window_size_; }
+
+    /** һеķֵ */
+    index_t peak_count() const { return peaks_.size(); }
+
+    /** һеĹ */
+    index_t zero_crossing_count() const { return zero_crossings_.size(); }
+
+    /**
+     * һÿķֵ
+     *
+     * @param fs Ƶ, ĬΪ1ʾÿһݵķֵ
+     */
+    value_t peak_rate(value_t fs = 1.0) const;
+
+    /** һÿĹ @sa peak_rate */
+    value_t zero_crossing_rate(value_t fs = 1.0) const;
+
+private:
+    // ̶±
+    class IndexRing
+    {
+    public:
+        explicit IndexRing(int capacity) : data_(capacity), head_(0), size_(0) {}
+
+        void push_back(position_t index);
+        void pop_older_than(position_t index);
+        void clear() { head_ = size_ = 0; }
+        index_t size() const { return size_; }
+
+    private:
+        std::vector<position_t> data_;
+        index_t head_;
+        index_t size_;
+    };
+
+    void expire();
+
+    int window_size_;
+    position_t position_;
+    value_t prev_;          /**< һ */
+    value_t prev_prev_;     /**< һ */
+
+    IndexRing peaks_;
+    IndexRing zero_crossings_;
+};
+
+/** @}*/
+}
+
+#endif // PEAK_ZERO_CROSSING_DETECTOR_H__
+
+/**
+ * @example test_peak_zero_crossing_detector.cpp
+ * An example for current module @ref peakzerocrossingdetector
+ */
@@ -0,0 +1,106 @@
+/**
+ * @file rot_resampler.h
+ * @brief Ԫеز
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef ROT_RESAMPLER_H__
+#define ROT_RESAMPLER_H__
+
+#include "../global.h"
+
+#include <deque>
+
+namespace smfe
+{
+/**
+ * @defgroup rotresampler rot-resampler
+ *
+ * Ԫеز
+ *
+ * `rotate_amg_mat` Ҫÿһ֡amgݶһӦԪ, ǳݺamgݵĲƵ
+ * ͬ. еʱ, ڵԪֵ֮õÿһamg֡ĳ.
+ *
+ * 1.   SLERPٲֵ, ƹ̶תʱǾȷ
+ * 2.   NLERPԲֵ֮һ, С, ԪнǺСʱSLERPͬ
+ *
+ * q  -q ʾͬһת, ֵ֮ǰѺһԪתǰһͬİ, Ž϶̵
+ * ֵ. ĿʱԪ֮ʱʹõһһԪ.
+ *
+ * ӿһι鲢ʱеõÿһ֡Ͳֵϵ, ٶֵ֡.
+ * `RotResampler` , ֻ滹õԪ.
+ *
+ * @{
+ */
+
+enum RotInterpolation {
+    SLERP_INTERPOLATION,
+    NLERP_INTERPOLATION
+};
+
+/**
+ * @brief ԪزĿʱ
+ *
+ * @param rot_mat ÿһΪһԪ @pre rot_mat.n_rows == 4 && rot_mat.n_cols > 0
+ * @param rot_times ÿһԪʱ, ϸ @pre rot_times.size() == rot_mat.n_cols
+ * @param target_times Ŀʱ, ݼ(amg֡ʱ)
+ * @param method ֵ
+ *
+ * @return 4*target_times.size() Ԫ, ֱ `rotate_amg_mat`
+ */
+mat resample_rot_mat(const mat& rot_mat, const vec& rot_times, const vec& target_times,
+                     RotInterpolation method = SLERP_INTERPOLATION);
+
+class RotResampler
+{
+public:
+    explicit RotResampler(RotInterpolation method = SLERP_INTERPOLATION);
+
+    /** һԪ @pre rot.size() == 4 time֮ǰʱ */
+    void push(value_t time, const vec& rot);
+
+    /** Ԫ @sa push */
+    void push(const mat& rot_mat, const vec& times);
+
+    /**
+     * @brief Ŀʱֵ
+     *
+     * ֻһԪʱĿ(֮Ԫûе), µԪ
+     * ֮ٴʣµĿ. еõĿʱϲݼ.
+     *
+     * @param target_times Ŀʱ
+     * @param out ǰ n ĿԪ, СΪ4*n
+     *
+     * @return Ŀn
+     */
+    index_t resample(const vec& target_times, mat& out);
+
+    /** Ԫ */
+    index_t n_buffered() const { return samples_.size(); }
+
+    void clear() { samples_.clear(); }
+
+private:
+    struct Sample {
+        value_t time;
+        value_t rot[4];
+    };
+
+    RotInterpolation method_;
+    std::deque<Sample> samples_;
+};
+
+/** @}*/
+}
+
+#endif // ROT_RESAMPLER_H__
+
+/**
+ * @example test_rot_resampler.cpp
+ * An example for current module @ref rotresampler
+ */
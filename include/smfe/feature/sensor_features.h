@@ -40,6 +40,8 @@ namespace smfe
  * @param filter_size ֵ˲ʹfilterĴС. i֡,ʹ[i-filter, i+filter_size]ֵ֮ƽ
  *
  * @return ʱ̵ٶֵ
+ *
+ * @sa Ҫ3ͬʱ, ʹüٶȺжϾֹ״̬ʱʹ zupt_velocity
  */
 value_t velocity(const vec& acce_data,
                  value_t delta = 1.0,
@@ -250,6 +252,8 @@ vec rotate_amg_vec(const vec& rot, const vec& amg_v);
  *
  * @pre amg_mat.n_rows == 9 && rot_mat.n_rows == 4 && rot_mat.n_cols == amg_mat.n_cols
  * 
+ * ݺamgݲƵʲͬʱʹ resample_rot_mat 
+ *
  * @param rot_mat Ӧÿһ֡µԪ
  * @param amg_mat amg
  *
@@ -257,6 +261,21 @@ vec rotate_amg_vec(const vec& rot, const vec& amg_v);
  */
 mat rotate_amg_mat(const mat& rot_mat, const mat& amg_mat);
 
+/**
+ * @brief rotate_amg_channels ֻתchannelsѡĴ @sa rotate_amg_mat
+ *
+ * ֻҪٶȻǵҪתamg, תļѡĴ.
+ *
+ * @pre amg_mat.n_rows == 9 && rot_mat.n_rows == 4 && rot_mat.n_cols == amg_mat.n_cols
+ *
+ * @param rot_mat Ӧÿһ֡µԪ
+ * @param amg_mat amg
+ * @param channels ҪĴ,  AcceMask | GyroMask @sa ChannelMask
+ *
+ * @return תľ, Ϊ 3*channel_count(channels), a, m, g˳򱣴ѡĴ
+ */
+mat rotate_amg_channels(const mat& rot_mat, const mat& amg_mat, int channels);
+
 /**
  * @brief moving_distance_of_amg_vec amg һʱഫƶ, .  @sa distance
  *
@@ -303,6 +322,7 @@ vec last_velocity_of_amg_vec(const vec& rot, const mat& amg_mat,
  * @brief rotated_angle_of_amg_vec һʱഫתĽǶ, 
  *
  * ʹûֵķʽ @sa integration
+ * ֱ, ûпתĲɽ @sa integrate_gyro
  *
  * @param rot ȫת
  * @param amg_mat ֲϵµamg
@@ -0,0 +1,124 @@
+/**
+ * @file sliding_dft.h
+ * @brief ƵʵĻDFT
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef SLIDING_DFT_H__
+#define SLIDING_DFT_H__
+
+#include "frequency_domain_features.h"
+
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup slidingdft sliding-dft
+ *
+ * DFT
+ *
+ * ֻҪټƵ(粽Ƶ 1-3Hz,  4-12Hz), ÿƶһݾͶһ
+ * `smfe_fft` Ƿǳ˷ѵ. `SlidingDft` ֻάҪٵƵʵ, ÿһݵʱʹ
+ * ƹʽ:
+ *
+ *      X_k(t) = (X_k(t-1) - x(t-N) + x(t)) * exp(j*2*pi*k/N)
+ *
+ * ÿһݵļΪO(ٵƵʵ), ʹڳ޹. Ϊ˱Ƶۼ,
+ * ÿһڳȻʹôе¼һ(̯֮ĸӶȲ).
+ *
+ * ķֵƵʹ `frequency_magnitude_vec` ͬĵλ, Ҳ˵һڵ
+ *  `frequency_magnitude_vec` õĶӦƵʵĽͬ.
+ *
+ * @{
+ */
+
+class SlidingDft
+{
+public:
+    /**
+     * @param window_size ڳN, ƵʷֱΪ fs/N @pre window_size > 0
+     * @param fs Ƶ
+     */
+    SlidingDft(int window_size, value_t fs);
+
+    /**
+     * @brief ٵkƵʵ(ƵΪ k*fs/N)
+     *
+     * κʱ, ʱʹôеݼһ
+     *
+     * @param k Ƶʵ± @pre 0 <= k <= N/2
+     * @return Ƶʵڸбе @sa bin
+     */
+    int add_bin(int k);
+
+    /**
+     * @brief һƵ [low_fre, high_fre] еƵʵ
+     *
+     * @return Ƶ @sa band_energy
+     */
+    int add_band(value_t low_fre, value_t high_fre);
+
+    /** һ */
+    void push(value_t value);
+
+    /** μһ */
+    void push(const vec& data);
+
+    /** մ, ٵƵʵƵ */
+    void clear();
+
+    int window_size() const { return buffer_.size(); }
+
+    /** ǷѾ. û֮ǰ, ȱٵݵ0 */
+    bool full() const { return count_ >= buffer_.size(); }
+
+    /** ٵƵʵ */
+    int n_bins() const { return bins_.size(); }
+
+    /** iٵƵʵ<b>Ƶ-ֵ</b> */
+    FrequencyMagnitude bin(int i) const;
+
+    /** иٵƵʵ, ռ˳ */
+    fm_vec bins() const;
+
+    /** ƵƵʵֵƽ @sa frequency_energy */
+    value_t band_energy(int band) const;
+
+    /** ٵƵʵзֵһ @pre n_bins() > 0 */
+    FrequencyMagnitude dominant() const;
+
+private:
+    struct Bin {
+        int k;
+        complex_t twiddle;  /**< exp(j*2*pi*k/N) */
+        complex_t value;
+    };
+
+    void resync();
+    complex_t dft_of_window(int k) const;
+
+    value_t fs_;
+    std::vector<value_t> buffer_;   /**< N, head_ָɵ */
+    index_t head_;
+    index_t count_;
+
+    std::vector<complex_t> roots_;  /**< exp(-j*2*pi*n/N), n=[0, N) */
+    std::vector<Bin> bins_;
+    std::vector<std::vector<int> > bands_;  /**< ÿһƵƵʵ */
+};
+
+/** @}*/
+}
+
+#endif // SLIDING_DFT_H__
+
+/**
+ * @example test_sliding_dft.cpp
+ * An example for current module @ref slidingdft
+ */
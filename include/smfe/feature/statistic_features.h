@@ -112,6 +112,15 @@ value_t energy(const vec& source);
 */
 value_t entropy(const vec& source, int nbins);
 
+/**
+* Ϣ, ÿһΪһͨһ @sa entropy @sa HistogramEntropy
+*
+* @param windows ÿһбһź
+* @param nbins ֱͼĸ, Χ[1, +inf)
+* @return ÿһźŵϢ
+*/
+vec entropy(const mat& windows, int nbins);
+
 /**
  * Calculates power of the signal.
  *
@@ -0,0 +1,139 @@
+/**
+ * @file stft.h
+ * @brief ʱҶ任Լÿһ֡Ƶ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef STFT_H__
+#define STFT_H__
+
+#include "../global.h"
+#include "window_function.h"
+#include "histogram_entropy.h"
+
+#include <memory>
+
+namespace smfe
+{
+namespace fft
+{
+class RealFftPlan;
+template<typename T> class AlignedBuffer;
+}
+
+/**
+ * @defgroup stft stft
+ *
+ * ʱҶ任(spectrogram)
+ *
+ * źűΪΪ frame_size, Ϊ hop_size ֡( Aquila::FramesCollection һ,
+ * ֻ֡), ÿһ֡Դ֮ʵfft. ֡ķֵһľ,
+ * ÿһΪһ֡, Ϊ frame_size/2 + 1.
+ *
+ * ֵĵλ `frequency_magnitude_vec` һ, ʹôĺʹݳȽйһ,
+ * ԶھδߵĽͬ, , źŵķֵȻԱȷ.
+ *
+ * ֵͬʱõÿһ֡Ƶ(Ƶ, , Ϣ, Ƶ), Ҫٱһ
+ * Ƶ. ͬȵfftƻڽֻһ, еĻڶظʹ.
+ *
+ * @{
+ */
+
+/** ÿһ֡Ƶ, ÿһĳΪ֡ */
+struct StftFeatures {
+    vec principal_frequency;    /**< ֵƵ @sa principal_frequency */
+    vec energy;                 /**< ֵƽ @sa frequency_energy */
+    vec entropy;                /**< ֵϢ @sa frequency_domain_entropy */
+    vec centroid;               /**< Ƶ sum(f*mag) / sum(mag) */
+};
+
+class Stft
+{
+public:
+    /**
+     * @param frame_size ֡ @pre frame_size > 0
+     * @param hop_size ֮֡ļ @pre hop_size > 0
+     * @param fs Ƶ
+     * @param window 
+     * @param entropy_nbins Ϣʹõֱͼ @sa frequency_domain_entropy
+     */
+    Stft(int frame_size, int hop_size, value_t fs, WindowType window = HANN_WINDOW,
+         int entropy_nbins = 10);
+
+    ~Stft();
+
+    /**
+     * @brief һź֡Ƶ
+     *
+     * @return ֡, ͨ magnitude()  features() õ
+     */
+    index_t compute(const vec& source);
+
+    /**
+     * @brief ʽ, µ
+     *
+     * ֻһ֡ص, ÿչһ֡ͼһ. ֻεɵ֡,
+     * еõĽͶźŵ compute Ľһ.
+     *
+     * @return εɵ֡
+     */
+    index_t push(const vec& samples);
+
+    /** ʽл */
+    void clear();
+
+    int frame_size() const { return frame_size_; }
+    int hop_size() const { return hop_size_; }
+
+    /** ÿһ֡Ƶʵĸ frame_size/2 + 1 */
+    int n_bins() const { return frame_size_ / 2 + 1; }
+
+    /** ÿһжӦƵ */
+    const vec& frequencies() const { return frequencies_; }
+
+    /** ֵ, ÿһΪһ֡ */
+    const mat& magnitude() const { return magnitude_; }
+
+    /** ÿһ֡ */
+    const StftFeatures& features() const { return features_; }
+
+private:
+    Stft(const Stft&);
+    Stft& operator=(const Stft&);
+
+    void prepare(index_t n_frames);
+    void process_frame(const value_t* data, index_t column);
+
+    int frame_size_;
+    int hop_size_;
+    value_t scale_;         /**< 2 / sum(window) */
+
+    vec window_;
+    vec frequencies_;
+    std::shared_ptr<const fft::RealFftPlan> plan_;
+    std::unique_ptr<fft::AlignedBuffer<value_t> > in_;
+    std::unique_ptr<fft::AlignedBuffer<complex_t> > out_;
+    HistogramEntropy entropy_;
+
+    mat magnitude_;
+    StftFeatures features_;
+
+    vec buffer_;            /**< ʽлûдչһ֡ */
+    index_t buffered_;
+    index_t skip_;          /**< hop_size > frame_size ʱ, Ҫݸ */
+};
+
+/** @}*/
+}
+
+#endif // STFT_H__
+
+/**
+ * @example test_stft.cpp
+ * An example for current module @ref stft
+ */
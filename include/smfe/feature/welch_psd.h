@@ -0,0 +1,116 @@
+/**
+ * @file welch_psd.h
+ * @brief Welchƹܶ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef WELCH_PSD_H__
+#define WELCH_PSD_H__
+
+#include "frequency_domain_features.h"
+#include "window_function.h"
+
+#include <memory>
+
+namespace smfe
+{
+namespace fft
+{
+class RealFftPlan;
+}
+
+/**
+ * @defgroup welchpsd welch-psd
+ *
+ * Welch׹
+ *
+ * `frequency_magnitude_vec` Ƕźһfftõͼ, ܴ, fftĳȺź
+ * ͬ. WelchźŷΪɸ໥صĶ, ÿһμӴ֮ͼ, ж
+ * ȡƽ. Ƶʷֱɶγ, źŲҪܴfft.
+ *
+ * 1.   `psd()` Ϊ߹ܶ, λΪ źŵλ^2/Hz
+ * 2.   `frequency_magnitude_vec()` Ϊƽ֮ķֵ, λ `frequency_magnitude_vec` һ
+ * (δֻһεʱߵĽͬ), ֱ `principal_frequency`(֮),
+ * `frequency_energy`, `frequency_domain_entropy` Ƚӿ
+ *
+ * жιһfftƻ, ÿһ߳ʹԼĻ. ظʹ, μ㲻
+ * ƻʹ.
+ *
+ * @{
+ */
+
+class WelchPsd
+{
+public:
+    /**
+     * @param segment_size ÿһεĳ @pre segment_size > 0
+     * @param overlap صݸ @pre 0 <= overlap < segment_size
+     * @param fs Ƶ
+     * @param window ÿһʹõĴ
+     */
+    WelchPsd(int segment_size, int overlap, value_t fs, WindowType window = HANN_WINDOW);
+
+    ~WelchPsd();
+
+    /**
+     * @brief 㹦ܶ
+     *
+     * @param source ź @pre source.size() >= segment_size
+     * @param n_threads м߳Ŀ, 1ʾڵǰ߳м @pre n_threads >= 1
+     *
+     * @return ܶ, Ϊ segment_size/2 + 1
+     */
+    const vec& compute(const vec& source, int n_threads = 1);
+
+    /** һμĹܶ */
+    const vec& psd() const { return psd_; }
+
+    /** ÿһƵʵӦƵ */
+    const vec& frequencies() const { return frequencies_; }
+
+    /** һμʹõĶ */
+    index_t n_segments() const { return n_segments_; }
+
+    /** һμƽֵ, ƵʴС @sa frequency_magnitude_vec */
+    fm_vec frequency_magnitude_vec() const;
+
+private:
+    WelchPsd(const WelchPsd&);
+    WelchPsd& operator=(const WelchPsd&);
+
+    void accumulate(const vec& source, index_t first, index_t last, vec& power) const;
+
+    int segment_size_;
+    int step_;
+    value_t fs_;
+    vec window_;
+    value_t window_sum_;
+    value_t window_sq_sum_;
+    vec frequencies_;
+    std::shared_ptr<const fft::RealFftPlan> plan_;
+
+    vec power_;         /**< ж |X|^2 ƽ */
+    vec psd_;
+    index_t n_segments_;
+};
+
+/**
+ * @brief ʹWelchõ<b>Ƶ-ֵ</b>Ϣ @sa WelchPsd
+ */
+fm_vec welch_frequency_magnitude_vec(const vec& source, value_t fs, int segment_size, int overlap,
+                                     WindowType window = HANN_WINDOW, int n_threads = 1);
+
+/** @}*/
+}
+
+#endif // WELCH_PSD_H__
+
+/**
+ * @example test_welch_psd.cpp
+ * An example for current module @ref welchpsd
+ */
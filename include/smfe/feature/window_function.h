@@ -0,0 +1,63 @@
+/**
+ * @file window_function.h
+ * @brief ʱʹõĴ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef WINDOW_FUNCTION_H__
+#define WINDOW_FUNCTION_H__
+
+#include "../global.h"
+
+#include <string>
+
+namespace smfe
+{
+/**
+ * @defgroup windowfunction window-function
+ *
+ * , AquilaṩĴԼ㹫ʽһ
+ *
+ * @{
+ */
+
+enum WindowType {
+    RECTANGULAR_WINDOW,
+    HANN_WINDOW,
+    HAMMING_WINDOW,
+    BLACKMAN_WINDOW,
+    BARLETT_WINDOW,
+    FLATTOP_WINDOW
+};
+
+/**
+ * @brief ɴ
+ *
+ * @param type 
+ * @param size ڳ @pre size > 0
+ *
+ * @return ΪsizeĴϵ
+ */
+vec make_window(WindowType type, int size);
+
+/**
+ * Ƶõ, Ϊ "Rectangular", "Hann", "Hamming", "Blackman", "Barlett", "Flattop"
+ *
+ * @throw std::invalid_argument ƲһϷĴ
+ */
+WindowType window_type_from_string(const std::string& str);
+
+/** @}*/
+}
+
+#endif // WINDOW_FUNCTION_H__
+
+/**
+ * @example test_stft.cpp
+ * An example for current module @ref windowfunction
+ */
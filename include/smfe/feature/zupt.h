@@ -0,0 +1,112 @@
+/**
+ * @file zupt.h
+ * @brief ֹ(ZUPT)
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef ZUPT_H__
+#define ZUPT_H__
+
+#include "../global.h"
+
+namespace smfe
+{
+/**
+ * @defgroup zupt zupt
+ *
+ * 
+ *
+ * `velocity` ÿһᵥжϼٶǷСֵ, ֹһ֮֡ٶǿΪ0,
+ * ÿһεöҪж. ֿ:
+ *
+ * 1.   `StationaryDetector` ݼٶȵģ(ԼģһСڵķ)ǵģ
+ * жϴǷֹ, õֹ. ÿһֻҪһ.
+ * 2.   `zupt_velocity` 3ͬʱ, ھֹٶΪ0. ÿһ˶(뾲ֹ)
+ * ʱֵõٶӦΪ0, ʣµֵǼٶƫۻ, ʱԵشһ˶
+ * ٶмȥ.
+ *
+ * ʹú `effective_duration_index_pair_vec` ͬĸʽ, ÿһ±ʾ [first, last] ı.
+ *
+ * @{
+ */
+
+class StationaryDetector
+{
+public:
+    /**
+     * @param gravity ֹʱٶȵģ
+     * @param acce_threshold ֹʱٶģgravityֵ֮ @pre acce_threshold >= 0
+     * @param acce_variance_threshold ֹʱٶģڴڷֵ @pre acce_variance_threshold >= 0
+     * @param gyro_threshold ֹʱģֵ @pre gyro_threshold >= 0
+     * @param half_window 㷽ĴΪ [i-half_window, i+half_window] @pre half_window >= 0
+     * @param min_frames ֹٵ֡ @pre min_frames > 0
+     */
+    StationaryDetector(value_t gravity,
+                       value_t acce_threshold,
+                       value_t acce_variance_threshold,
+                       value_t gyro_threshold,
+                       int half_window = 2,
+                       int min_frames = 5
+                      );
+
+    /**
+     * @brief ⾲ֹ
+     *
+     * @param acce ٶ, ÿһһ֡3
+     * @param gyro , ÿһһ֡3 @pre gyroacceĴСͬ
+     *
+     * @return оֹ, ʱ˳
+     */
+    index_pair_vec detect(const mat& acce, const mat& gyro) const;
+
+    /** amgм⾲ֹ @sa unpack_amg_mat */
+    index_pair_vec detect(const mat& amg_mat) const;
+
+private:
+    value_t gravity_;
+    value_t acce_threshold_;
+    value_t acce_variance_threshold_;
+    value_t gyro_threshold_;
+    int half_window_;
+    int min_frames_;
+};
+
+/**
+ * @brief ʹ3ٶȻֵõٶ
+ *
+ * ֺ `velocity` һʹιʽ: v[i] = v[i-1] + (a[i-1] + a[i]) / 2 * delta
+ *
+ * @param acce ȫȥ֮ļٶ, ÿһһ֡3
+ * @param delta ֡ʱ
+ * @param stationary ֹ @sa StationaryDetector
+ * @param init_velocity һ֡ٶ, Ϊձʾ0 @pre init_velocityΪջ߳Ϊ3
+ *
+ * @return ÿһ֡ٶ, Сacceͬ
+ */
+mat zupt_velocity(const mat& acce, value_t delta, const index_pair_vec& stationary,
+                  const vec& init_velocity = vec());
+
+/**
+ * @brief ٶȻֵõλ
+ *
+ * @param velocity ÿһһ֡3ٶ @sa zupt_velocity
+ * @param delta ֡ʱ
+ *
+ * @return 3ϵλ
+ */
+vec zupt_displacement(const mat& velocity, value_t delta);
+
+/** @}*/
+}
+
+#endif // ZUPT_H__
+
+/**
+ * @example test_zupt.cpp
+ * An example for current module @ref zupt
+ */
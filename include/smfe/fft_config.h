@@ -0,0 +1,103 @@
+/**
+ * @file fft_config.h
+ * @brief fftƻȫ
+ * @author whiledoing
+ * @date 2026-10-19
+ */
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef FFT_CONFIG_H__
+#define FFT_CONFIG_H__
+
+#include "global.h"
+
+#include <string>
+#include <vector>
+
+namespace smfe
+{
+/**
+ * @defgroup fftconfig fft-config
+ *
+ * еfft(`smfe_fft`, `Stft`, `WelchPsd` )ͨfftw, ÿһȵļƻڽ
+ * ֻһ. fftwɼƻʱ۵Ϣ(wisdom)Ա浽ļ, һʱ,
+ * ͬȵļƻҪ¼.
+ *
+ * Ĭʹ `FFT_ESTIMATE` ɼƻ, ɺܿ쵫Ǽ㲻ŵ. פķʱ
+ * `fft_init` ѡߵĵȼ,  `fft_prepare` ǰдڳȵļƻ, ֮
+ * `fft_save_wisdom` . һʱwisdom, ͬļƻûп:
+ *
+ *      smfe::fft_init("smfe.wisdom", smfe::FFT_MEASURE);
+ *      smfe::fft_prepare(window_sizes);
+ *      smfe::fft_save_wisdom();
+ *
+ * @{
+ */
+
+/** fftƻĵȼ, ȼԽ߼ƻԽ, õļƻԽ */
+enum FftPlanningLevel {
+    FFT_ESTIMATE = 0,   /**< , ݾѡ㷨 */
+    FFT_MEASURE = 1,    /**< 㷨, ѡһ */
+    FFT_PATIENT = 2,    /**< Ը㷨 */
+    FFT_EXHAUSTIVE = 3  /**< е㷨 */
+};
+
+/**
+ * @brief ʼfft
+ *
+ * ֮ɼƻʹõĵȼ, wisdom_pathΪ, ļеwisdom, Ҽ¼·
+ *  `fft_save_wisdom` ʹ. Ѿļƻᱻ, ֮µĵȼ.
+ * С任ʹfftwľͬʹȼ.
+ *
+ * @note ̰߳ȫ, Ӧڳ, κ֮ǰ
+ *
+ * @return Ƿɹwisdom, ļ(һ)ʱ򷵻false
+ */
+bool fft_init(const std::string& wisdom_path, FftPlanningLevel level = FFT_MEASURE);
+
+/** ǰɼƻʹõĵȼ */
+FftPlanningLevel fft_planning_level();
+
+/**
+ * @brief ǰɳΪsizesļƻ
+ *
+ * ʹýϸߵȼʱ, ÿһȵһμfftȽ, ʱ, ڼʱ
+ * ɼƻ
+ */
+void fft_prepare(const std::vector<int>& sizes);
+
+/**
+ * @brief wisdom浽 `fft_init` ָļ
+ *
+ * @return ûָļļдʱ򷵻false
+ */
+bool fft_save_wisdom();
+
+/**
+ * @brief ļеfftwwisdom
+ *
+ * Ӧڼκfft֮ǰ, ѾɵļƻܵӰ
+ *
+ * @return ļڻ߸ʽȷʱ򷵻false
+ */
+bool fft_import_wisdom(const std::string& path);
+
+/**
+ * @brief ѵǰ̻۵wisdom浽ļ
+ *
+ * @return ļдʱ򷵻false
+ */
+bool fft_export_wisdom(const std::string& path);
+
+/** @}*/
+}
+
+#endif // FFT_CONFIG_H__
+
+/**
+ * @example test_frequency_domain_features.cpp
+ * An example for current module @ref fftconfig
+ */
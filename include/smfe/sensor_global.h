@@ -33,6 +33,27 @@ inline ChannelType channel_type_from_string(const std::string& str)
 	throw std::invalid_argument(str + " is not a valid channel type");
 }
 
+/**
+ * ѡamgɸ, iλӦChannelTypeΪiĴ, ʹ | 
+ */
+enum ChannelMask {
+    AcceMask = 1 << Acce,
+    MagMask = 1 << Mag,
+    GyroMask = 1 << Gyro,
+    AmgMask = AcceMask | MagMask | GyroMask
+};
+
+inline int channel_mask(ChannelType type)
+{
+    return 1 << type;
+}
+
+/** amgĸ */
+inline int channel_count(int channels)
+{
+    return ((channels & AcceMask) ? 1 : 0) + ((channels & MagMask) ? 1 : 0) + ((channels & GyroMask) ? 1 : 0);
+}
+
 }
 
 #endif // SENSOR_GLOBAL_H__
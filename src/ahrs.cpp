@@ -0,0 +1,129 @@
+#include "smfe/feature/ahrs.h"
+
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+#include "kernel/ahrs_kernels.h"
+
+namespace smfe
+{
+MadgwickAhrs::MadgwickAhrs(value_t delta, value_t beta /*= 0.1*/, const vec& init_rot /*= vec()*/)
+    : delta_(delta), beta_(beta)
+{
+    reset(init_rot);
+}
+
+void MadgwickAhrs::reset(const vec& rot /*= vec()*/)
+{
+    BOOST_ASSERT(rot.empty() || rot.size() == 4);
+
+    if(rot.empty()) {
+        rot_.zeros(4);
+        rot_[0] = 1.0;
+    } else {
+        rot_ = rot;
+    }
+}
+
+// ֻһ豸ʱֿźͽͬ, ֱʹ rot_ ڴ
+const vec& MadgwickAhrs::update(const vec& amg_v)
+{
+    BOOST_ASSERT(amg_v.size() == 9);
+
+    kernel::ahrs_kernels().madgwick(rot_.memptr(), amg_v.memptr(), 1, beta_, delta_);
+    return rot_;
+}
+
+void MadgwickAhrs::update(const mat& amg_mat, mat& rot_mat)
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9);
+
+    rot_mat.set_size(4, amg_mat.n_cols);
+
+    const kernel::AhrsKernels& k = kernel::ahrs_kernels();
+    value_t* q = rot_.memptr();
+    for(index_t i = 0u; i < amg_mat.n_cols; ++i) {
+        k.madgwick(q, amg_mat.colptr(i), 1, beta_, delta_);
+
+        value_t* out = rot_mat.colptr(i);
+        out[0] = q[0]; out[1] = q[1]; out[2] = q[2]; out[3] = q[3];
+    }
+}
+
+mat MadgwickAhrs::update(const mat& amg_mat)
+{
+    mat rot_mat;
+    update(amg_mat, rot_mat);
+    return rot_mat;
+}
+
+MadgwickAhrsBank::MadgwickAhrsBank(int n_devices, value_t delta, value_t beta /*= 0.1*/)
+    : n_devices_(n_devices), delta_(delta), beta_(beta)
+{
+    BOOST_ASSERT(n_devices > 0);
+
+    reset();
+}
+
+void MadgwickAhrsBank::reset()
+{
+    q_.assign(4 * n_devices_, 0.0);
+    std::fill(q_.begin(), q_.begin() + n_devices_, 1.0);
+}
+
+void MadgwickAhrsBank::update(const mat& amg_frames, mat& rot_frames)
+{
+    BOOST_ASSERT(amg_frames.n_rows == 9 && amg_frames.n_cols == (index_t)n_devices_);
+
+    kernel::ahrs_kernels().madgwick(q_.data(), amg_frames.memptr(), n_devices_, beta_, delta_);
+
+    rot_frames.set_size(4, n_devices_);
+    for(int c = 0; c < 4; ++c) {
+        const value_t* src = &q_[c * n_devices_];
+        for(int d = 0; d < n_devices_; ++d)
+            rot_frames(c, d) = src[d];
+    }
+}
+
+void MadgwickAhrsBank::update(const std::vector<mat>& amg_mats, std::vector<mat>& rot_mats)
+{
+    BOOST_ASSERT(amg_mats.size() == (size_t)n_devices_);
+
+    const index_t n_frames = amg_mats[0].n_cols;
+    rot_mats.resize(n_devices_);
+    for(int d = 0; d < n_devices_; ++d) {
+        BOOST_ASSERT(amg_mats[d].n_rows == 9 && amg_mats[d].n_cols == n_frames);
+        rot_mats[d].set_size(4, n_frames);
+    }
+
+    const kernel::AhrsKernels& k = kernel::ahrs_kernels();
+    amg_frames_.set_size(9, n_devices_);
+    for(index_t i = 0u; i < n_frames; ++i) {
+        // ÿһ豸ĵi֡һ, kernelһδ豸
+        for(int d = 0; d < n_devices_; ++d) {
+            const value_t* src = amg_mats[d].colptr(i);
+            std::copy(src, src + 9, amg_frames_.colptr(d));
+        }
+
+        k.madgwick(q_.data(), amg_frames_.memptr(), n_devices_, beta_, delta_);
+
+        for(int d = 0; d < n_devices_; ++d) {
+            value_t* out = rot_mats[d].colptr(i);
+            for(int c = 0; c < 4; ++c)
+                out[c] = q_[c * n_devices_ + d];
+        }
+    }
+}
+
+vec MadgwickAhrsBank::rotation(int device) const
+{
+    BOOST_ASSERT(device >= 0 && device < n_devices_);
+
+    vec rot(4);
+    for(int c = 0; c < 4; ++c)
+        rot[c] = q_[c * n_devices_ + device];
+    return rot;
+}
+
+}
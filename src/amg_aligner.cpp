@@ -0,0 +1,187 @@
+#include "smfe/feature/amg_aligner.h"
+
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+AmgAligner::AmgAligner(value_t delta, int channels /*= AmgMask*/, ResampleMethod method /*= CUBIC_RESAMPLE*/)
+    : delta_(delta), channels_(channels & AmgMask), method_(method), started_(false), start_time_(0.0),
+      n_frames_(0)
+{
+    BOOST_ASSERT(delta > 0);
+    BOOST_ASSERT(channels_ != 0);
+}
+
+void AmgAligner::push(ChannelType type, value_t time, const vec& v)
+{
+    BOOST_ASSERT(type == Acce || type == Mag || type == Gyro);
+    BOOST_ASSERT(v.size() == 3);
+
+    if(!(channels_ & channel_mask(type)))
+        return;
+
+    Stream& s = streams_[type];
+    BOOST_ASSERT(s.empty() || time > s.back().time);
+
+    Sample sample;
+    sample.time = time;
+    for(int c = 0; c < 3; ++c)
+        sample.v[c] = v[c];
+    s.push_back(sample);
+}
+
+void AmgAligner::push(ChannelType type, const vec& times, const mat& data)
+{
+    BOOST_ASSERT(data.n_rows == 3 && times.size() == data.n_cols);
+
+    for(index_t i = 0u; i < data.n_cols; ++i)
+        push(type, times[i], data.col(i));
+}
+
+index_t AmgAligner::pull(mat& amg_mat, vec& times)
+{
+    return emit(false, amg_mat, times);
+}
+
+index_t AmgAligner::flush(mat& amg_mat, vec& times)
+{
+    return emit(true, amg_mat, times);
+}
+
+void AmgAligner::clear()
+{
+    for(int type = 0; type < 3; ++type)
+        streams_[type].clear();
+    started_ = false;
+    start_time_ = 0.0;
+    n_frames_ = 0;
+}
+
+bool AmgAligner::ready(const Stream& s, value_t t, bool final) const
+{
+    if(s.empty())
+        return false;
+    if(final)
+        return t <= s.back().time;
+
+    // ֵҶ˵, βֵҪ֮һݼб
+    const index_t after = (method_ == CUBIC_RESAMPLE) ? 2 : 1;
+    index_t k = 0;
+    while(k + 1 < s.size() && s[k + 1].time <= t)
+        ++k;
+    return k + after < s.size();
+}
+
+void AmgAligner::interpolate(const Stream& s, value_t t, value_t* out) const
+{
+    index_t k = 0;
+    while(k + 1 < s.size() && s[k + 1].time <= t)
+        ++k;
+
+    const Sample& p0 = s[k];
+    if(k + 1 == s.size() || t <= p0.time) {
+        for(int c = 0; c < 3; ++c)
+            out[c] = p0.v[c];
+        return;
+    }
+
+    const Sample& p1 = s[k + 1];
+    const value_t h = p1.time - p0.time;
+    const value_t u = (t - p0.time) / h;
+
+    if(method_ == LINEAR_RESAMPLE) {
+        for(int c = 0; c < 3; ++c)
+            out[c] = p0.v[c] + u * (p1.v[c] - p0.v[c]);
+        return;
+    }
+
+    // ֶHermite, ˵бʹݵĲ, ûݵʱʹõ
+    const Sample& prev = (k > 0) ? s[k - 1] : p0;
+    const Sample& next = (k + 2 < s.size()) ? s[k + 2] : p1;
+
+    const value_t u2 = u * u, u3 = u2 * u;
+    const value_t h00 = 2 * u3 - 3 * u2 + 1;
+    const value_t h10 = u3 - 2 * u2 + u;
+    const value_t h01 = -2 * u3 + 3 * u2;
+    const value_t h11 = u3 - u2;
+
+    for(int c = 0; c < 3; ++c) {
+        value_t m0 = (p1.v[c] - prev.v[c]) / (p1.time - prev.time);
+        value_t m1 = (next.v[c] - p0.v[c]) / (next.time - p0.time);
+        out[c] = h00 * p0.v[c] + h10 * h * m0 + h01 * p1.v[c] + h11 * h * m1;
+    }
+}
+
+index_t AmgAligner::emit(bool final, mat& amg_mat, vec& times)
+{
+    if(!started_) {
+        bool all = true, found = false;
+        value_t start = 0.0;
+        for(int type = 0; type < 3; ++type) {
+            if(!(channels_ & channel_mask((ChannelType)type)))
+                continue;
+            if(streams_[type].empty()) {
+                all = false;
+                break;
+            }
+            if(!found || streams_[type].front().time > start)
+                start = streams_[type].front().time;
+            found = true;
+        }
+
+        if(!all) {
+            amg_mat.set_size(9, 0);
+            times.set_size(0);
+            return 0;
+        }
+
+        started_ = true;
+        start_time_ = start;
+    }
+
+    std::vector<value_t> values, frame_times;
+    while(true) {
+        // ʹó˷õʱ, ۼӵ
+        const value_t t = start_time_ + n_frames_ * delta_;
+
+        bool all = true;
+        for(int type = 0; type < 3 && all; ++type) {
+            if(channels_ & channel_mask((ChannelType)type))
+                all = ready(streams_[type], t, final);
+        }
+        if(!all)
+            break;
+
+        value_t frame[9] = {0.0};
+        for(int type = 0; type < 3; ++type) {
+            if(!(channels_ & channel_mask((ChannelType)type)))
+                continue;
+
+            Stream& s = streams_[type];
+            interpolate(s, t, frame + 3 * type);
+
+            // ֮֡õֵ˵֮ǰڶ
+            while(s.size() > 2 && s[2].time <= t)
+                s.pop_front();
+        }
+
+        values.insert(values.end(), frame, frame + 9);
+        frame_times.push_back(t);
+        ++n_frames_;
+    }
+
+    const index_t n = frame_times.size();
+    amg_mat.set_size(9, n);
+    times.set_size(n);
+    for(index_t i = 0u; i < n; ++i) {
+        for(int r = 0; r < 9; ++r)
+            amg_mat(r, i) = values[9 * i + r];
+        times[i] = frame_times[i];
+    }
+
+    return n;
+}
+
+}
@@ -0,0 +1,137 @@
+#include "smfe/feature/calibration.h"
+#include "smfe/config_global.h"
+
+#include <sstream>
+
+#include <boost/assert.hpp>
+
+#include "kernel/signal_kernels.h"
+
+namespace smfe
+{
+namespace
+{
+const char* const SECTIONS[3] = { "acce", "mag", "gyro" };
+
+// ȡʹÿհ׷ָn, ûõʱ򱣳ԭֵ
+void read_values(const pt::ptree& config, const std::string& key, int n, value_t* dst)
+{
+    std::string str;
+    get_value_from_ptree(config, key, str, std::string());
+    if(str.empty())
+        return;
+
+    std::istringstream is(str);
+    for(int i = 0; i < n; ++i) {
+        if(!(is >> dst[i]))
+            throw_invalid_config(key + " needs " + boost::lexical_cast<std::string>(n) + " values");
+    }
+
+    std::string rest;
+    if(is >> rest)
+        throw_invalid_config(key + " needs " + boost::lexical_cast<std::string>(n) + " values");
+}
+}
+
+CalibrationModel::CalibrationModel()
+{
+    for(int c = 0; c < 3; ++c) {
+        value_t* k = params_ + 12 * c;
+        for(int i = 0; i < 12; ++i)
+            k[i] = 0.0;
+        k[0] = k[4] = k[8] = 1.0;
+    }
+}
+
+void CalibrationModel::set(ChannelType type, const mat& matrix, const vec& offset)
+{
+    BOOST_ASSERT(type >= Acce && type <= Gyro);
+    BOOST_ASSERT(matrix.n_rows == 3 && matrix.n_cols == 3 && offset.size() == 3);
+
+    value_t* k = params_ + 12 * type;
+    for(int r = 0; r < 3; ++r) {
+        for(int c = 0; c < 3; ++c)
+            k[3 * r + c] = matrix(r, c);
+        k[9 + r] = offset[r];
+    }
+}
+
+mat CalibrationModel::matrix(ChannelType type) const
+{
+    BOOST_ASSERT(type >= Acce && type <= Gyro);
+
+    const value_t* k = params_ + 12 * type;
+    mat res(3, 3);
+    for(int r = 0; r < 3; ++r) {
+        for(int c = 0; c < 3; ++c)
+            res(r, c) = k[3 * r + c];
+    }
+    return res;
+}
+
+vec CalibrationModel::offset(ChannelType type) const
+{
+    BOOST_ASSERT(type >= Acce && type <= Gyro);
+
+    return vec(params_ + 12 * type + 9, 3);
+}
+
+vec CalibrationModel::apply(const vec& amg_v) const
+{
+    BOOST_ASSERT(amg_v.size() == 9);
+
+    mat res = apply(mat(amg_v));
+    return res.col(0);
+}
+
+mat CalibrationModel::apply(const mat& amg_mat) const
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9);
+
+    mat res(9, amg_mat.n_cols);
+    for(index_t i = 0u; i < amg_mat.n_cols; ++i) {
+        const value_t* v = amg_mat.colptr(i);
+        value_t* o = res.colptr(i);
+        for(int s = 0; s < 3; ++s) {
+            const value_t* k = params_ + 12 * s;
+            value_t x = v[3*s] - k[9], y = v[3*s+1] - k[10], z = v[3*s+2] - k[11];
+            for(int r = 0; r < 3; ++r)
+                o[3*s+r] = k[3*r] * x + k[3*r+1] * y + k[3*r+2] * z;
+        }
+    }
+    return res;
+}
+
+CalibrationModel CalibrationModel::from_ptree(const pt::ptree& config)
+{
+    CalibrationModel model;
+    for(int s = 0; s < 3; ++s) {
+        value_t* k = model.params_ + 12 * s;
+        read_values(config, std::string(SECTIONS[s]) + ".matrix", 9, k);
+        read_values(config, std::string(SECTIONS[s]) + ".offset", 3, k + 9);
+    }
+    return model;
+}
+
+CalibrationModel CalibrationModel::from_config(std::istream& is)
+{
+    pt::ptree config;
+    pt::read_info(is, config);
+
+    return from_ptree(config);
+}
+
+mat calibrate_rotate_amg_mat(const CalibrationModel& model, const mat& rot_mat, const mat& amg_mat,
+                             int channels /*= AmgMask*/)
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9 && rot_mat.n_rows == 4 && rot_mat.n_cols == amg_mat.n_cols);
+    BOOST_ASSERT(channel_count(channels) > 0);
+
+    mat res(3 * channel_count(channels), amg_mat.n_cols);
+    kernel::signal_kernels().rotate_amg(rot_mat.memptr(), amg_mat.memptr(), amg_mat.n_cols, channels,
+                                        model.data(), res.memptr());
+
+    return res;
+}
+
+}
@@ -0,0 +1,93 @@
+#include "smfe/feature/cepstral_features.h"
+#include "smfe/feature/frequency_domain_features.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+namespace
+{
+const value_t PI = 3.14159265358979323846;
+
+// Ƶ, ûƵȡõ-inf
+const value_t MIN_BAND_ENERGY = 1e-12;
+
+value_t warp(value_t fre, FilterBankScale scale, value_t corner_fre)
+{
+    return scale == MEL_FILTER_BANK ? std::log(1.0 + fre / corner_fre) : fre;
+}
+
+value_t unwarp(value_t value, FilterBankScale scale, value_t corner_fre)
+{
+    return scale == MEL_FILTER_BANK ? corner_fre * (std::exp(value) - 1.0) : value;
+}
+}
+
+CepstralFeatures::CepstralFeatures(int window_size, value_t fs, int n_filters, int n_coefficients,
+                                   FilterBankScale scale /*= MEL_FILTER_BANK*/,
+                                   value_t corner_fre /*= 2.0*/)
+    : window_size_(window_size)
+{
+    BOOST_ASSERT(window_size > 1);
+    BOOST_ASSERT(n_filters > 0);
+    BOOST_ASSERT(n_coefficients > 0 && n_coefficients <= n_filters);
+    BOOST_ASSERT(corner_fre > 0);
+
+    // ˲ı߽warp֮Ŀ̶Ͼȷֲ, m˲ [edges[m], edges[m+2]]
+    const value_t low = warp(0.0, scale, corner_fre);
+    const value_t high = warp(fs / 2, scale, corner_fre);
+    vec edges(n_filters + 2);
+    for(int i = 0; i < n_filters + 2; ++i)
+        edges[i] = unwarp(low + (high - low) * i / (n_filters + 1), scale, corner_fre);
+
+    const int n_bins = window_size / 2 + 1;
+    filter_bank_.zeros(n_filters, n_bins);
+    for(int m = 0; m < n_filters; ++m) {
+        const value_t left = edges[m], center = edges[m + 1], right = edges[m + 2];
+        for(int k = 0; k < n_bins; ++k) {
+            const value_t fre = (value_t)(k) * fs / window_size;
+            if(fre > left && fre < center)
+                filter_bank_(m, k) = (fre - left) / (center - left);
+            else if(fre >= center && fre < right)
+                filter_bank_(m, k) = (right - fre) / (right - center);
+        }
+    }
+
+    // DCT-II
+    dct_.set_size(n_coefficients, n_filters);
+    for(int k = 0; k < n_coefficients; ++k) {
+        const value_t norm = std::sqrt((k == 0 ? 1.0 : 2.0) / n_filters);
+        for(int m = 0; m < n_filters; ++m)
+            dct_(k, m) = norm * std::cos(PI * k * (m + 0.5) / n_filters);
+    }
+}
+
+vec CepstralFeatures::compute(const vec& window) const
+{
+    return compute(mat(window));
+}
+
+mat CepstralFeatures::compute(const mat& windows, int n_threads /*= 1*/) const
+{
+    BOOST_ASSERT(windows.n_rows == (index_t)window_size_);
+
+    mat power = frequency_magnitude_mat(windows, n_threads);
+    power %= power;
+
+    mat band_energy = filter_bank_ * power;
+    band_energy.transform([](value_t e) { return std::log(std::max(e, MIN_BAND_ENERGY)); });
+
+    return dct_ * band_energy;
+}
+
+vec cepstral_features(const vec& source, value_t fs, int n_filters, int n_coefficients,
+                      FilterBankScale scale /*= MEL_FILTER_BANK*/, value_t corner_fre /*= 2.0*/)
+{
+    CepstralFeatures cepstral(source.size(), fs, n_filters, n_coefficients, scale, corner_fre);
+    return cepstral.compute(source);
+}
+
+}
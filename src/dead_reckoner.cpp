@@ -0,0 +1,122 @@
+#include "smfe/feature/dead_reckoner.h"
+#include "smfe/sensor_global.h"
+
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+#include "kernel/signal_kernels.h"
+
+namespace smfe
+{
+namespace
+{
+//  velocity ежϱһ
+const value_t ZERO_ERROR = 1e-7;
+}
+
+DeadReckoner::DeadReckoner(value_t delta,
+                           const vec& init_velocity /*= vec()*/,
+                           value_t still_acce_threshold /*= 0.0*/,
+                           int station_count_threshold /*= INT_MAX*/,
+                           const vec& gravity /*= vec()*/)
+    : delta_(delta), still_acce_threshold_(still_acce_threshold),
+      station_count_threshold_(station_count_threshold)
+{
+    BOOST_ASSERT(init_velocity.empty() || init_velocity.size() == 3);
+    BOOST_ASSERT(gravity.empty() || gravity.size() == 3);
+    BOOST_ASSERT(still_acce_threshold >= 0.0);
+    BOOST_ASSERT(station_count_threshold > 0);
+
+    for(int c = 0; c < 3; ++c) {
+        init_velocity_[c] = init_velocity.empty() ? 0.0 : init_velocity[c];
+        gravity_[c] = gravity.empty() ? 0.0 : gravity[c];
+    }
+
+    reset();
+}
+
+void DeadReckoner::reset()
+{
+    for(int c = 0; c < 3; ++c) {
+        state_.velocity[c] = init_velocity_[c];
+        state_.position[c] = 0.0;
+        state_.angle[c] = 0.0;
+        state_.last_acce[c] = 0.0;
+        state_.last_gyro[c] = 0.0;
+        state_.station_count[c] = 0;
+    }
+    state_.n_frames = 0;
+}
+
+void DeadReckoner::push(const value_t* rot, const value_t* amg)
+{
+    // ֻõٶȺ, ǰ3Ϊٶ, 3Ϊ
+    value_t global[6];
+    kernel::signal_kernels().rotate_amg(rot, amg, 1, AcceMask | GyroMask, nullptr, global);
+
+    value_t acce[3];
+    for(int c = 0; c < 3; ++c) {
+        acce[c] = global[c] - gravity_[c];
+        if(std::abs(acce[c]) < still_acce_threshold_)
+            acce[c] = 0.0;
+    }
+    const value_t* gyro = global + 3;
+
+    // һ֡ٶȾǳʼٶ
+    if(state_.n_frames > 0) {
+        for(int c = 0; c < 3; ++c) {
+            if(std::abs(acce[c]) < ZERO_ERROR)
+                ++state_.station_count[c];
+            else
+                state_.station_count[c] = 0;
+
+            const value_t last_velocity = state_.velocity[c];
+            if(state_.station_count[c] > station_count_threshold_)
+                state_.velocity[c] = 0.0;
+            else
+                state_.velocity[c] = ((state_.last_acce[c] + acce[c]) / 2) * delta_ + state_.velocity[c];
+
+            state_.position[c] += (last_velocity + state_.velocity[c]) / 2 * delta_;
+            state_.angle[c] += (state_.last_gyro[c] + gyro[c]) / 2 * delta_;
+        }
+    }
+
+    for(int c = 0; c < 3; ++c) {
+        state_.last_acce[c] = acce[c];
+        state_.last_gyro[c] = gyro[c];
+    }
+    ++state_.n_frames;
+}
+
+void DeadReckoner::push(const vec& rot, const vec& amg_v)
+{
+    BOOST_ASSERT(rot.size() == 4 && amg_v.size() == 9);
+
+    push(rot.memptr(), amg_v.memptr());
+}
+
+void DeadReckoner::push(const mat& rot_mat, const mat& amg_mat)
+{
+    BOOST_ASSERT(rot_mat.n_rows == 4 && amg_mat.n_rows == 9 && rot_mat.n_cols == amg_mat.n_cols);
+
+    for(index_t i = 0u; i < amg_mat.n_cols; ++i)
+        push(rot_mat.colptr(i), amg_mat.colptr(i));
+}
+
+vec DeadReckoner::velocity() const
+{
+    return vec(state_.velocity, 3);
+}
+
+vec DeadReckoner::position() const
+{
+    return vec(state_.position, 3);
+}
+
+vec DeadReckoner::angle() const
+{
+    return vec(state_.angle, 3);
+}
+
+}
@@ -0,0 +1,278 @@
+#include "smfe/feature/dtw.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <boost/assert.hpp>
+
+#include "parallel_parts.h"
+
+namespace smfe
+{
+namespace
+{
+const value_t INF = std::numeric_limits<value_t>::infinity();
+
+inline value_t frame_distance(const value_t* a, const value_t* b, index_t n_channels)
+{
+    value_t sum = 0.0;
+    for(index_t c = 0u; c < n_channels; ++c) {
+        value_t d = a[c] - b[c];
+        sum += d * d;
+    }
+    return sum;
+}
+
+int effective_band(int band, int n, int m)
+{
+    const int diff = std::abs(n - m);
+    if(band < 0)
+        return std::max(n, m);
+    return std::max(band, diff);
+}
+
+// shared_bestΪdistanceнСһ
+void publish_distance(std::atomic<value_t>& shared_best, value_t distance)
+{
+    value_t cur = shared_best.load(std::memory_order_relaxed);
+    while(distance < cur && !shared_best.compare_exchange_weak(cur, distance, std::memory_order_relaxed))
+        ;
+}
+
+void merge_stats(DtwMatcher::Stats& to, const DtwMatcher::Stats& from)
+{
+    to.kim_pruned += from.kim_pruned;
+    to.keogh_pruned += from.keogh_pruned;
+    to.abandoned += from.abandoned;
+    to.computed += from.computed;
+}
+}
+
+value_t dtw_distance(const mat& a, const mat& b, int band /*= -1*/,
+                     value_t abandon_above /*= inf*/)
+{
+    BOOST_ASSERT(a.n_rows == b.n_rows);
+
+    const int n = a.n_cols, m = b.n_cols;
+    if(n == 0 || m == 0)
+        return (n == m) ? 0.0 : INF;
+
+    const int w = effective_band(band, n, m);
+    const index_t n_channels = a.n_rows;
+
+    // D(i, j)ʹ1ʼ±, D(0, 0) = 0, ߽Ϊ
+    std::vector<value_t> prev(m + 1, INF), curr(m + 1, INF);
+    prev[0] = 0.0;
+
+    for(int i = 1; i <= n; ++i) {
+        const int lo = std::max(1, i - w);
+        const int hi = std::min(m, i + w);
+
+        curr[lo - 1] = INF;
+        value_t row_min = INF;
+        const value_t* ai = a.colptr(i - 1);
+
+        for(int j = lo; j <= hi; ++j) {
+            value_t best = std::min(prev[j - 1], std::min(prev[j], curr[j - 1]));
+            value_t cost = frame_distance(ai, b.colptr(j - 1), n_channels) + best;
+            curr[j] = cost;
+            row_min = std::min(row_min, cost);
+        }
+        if(hi < m)
+            curr[hi + 1] = INF;
+
+        // ֮ÿһеۼƴ۶СһеСֵ
+        if(row_min > abandon_above)
+            return INF;
+
+        prev.swap(curr);
+    }
+
+    return prev[m] > abandon_above ? INF : prev[m];
+}
+
+value_t dtw_distance(const vec& a, const vec& b, int band /*= -1*/,
+                     value_t abandon_above /*= inf*/)
+{
+    const mat ra(const_cast<value_t*>(a.memptr()), 1, a.size(), false);
+    const mat rb(const_cast<value_t*>(b.memptr()), 1, b.size(), false);
+    return dtw_distance(ra, rb, band, abandon_above);
+}
+
+value_t lb_kim(const mat& a, const mat& b)
+{
+    BOOST_ASSERT(a.n_rows == b.n_rows);
+    BOOST_ASSERT(a.n_cols > 0 && b.n_cols > 0);
+
+    value_t res = frame_distance(a.colptr(0), b.colptr(0), a.n_rows);
+
+    // ֻһ֡ʱβͬһ֡
+    if(a.n_cols > 1 || b.n_cols > 1)
+        res += frame_distance(a.colptr(a.n_cols - 1), b.colptr(b.n_cols - 1), a.n_rows);
+
+    return res;
+}
+
+void dtw_envelope(const mat& series, int band, mat& lower, mat& upper)
+{
+    const int n = series.n_cols;
+    const int w = band < 0 ? n : band;
+
+    lower.set_size(series.n_rows, n);
+    upper.set_size(series.n_rows, n);
+
+    for(int i = 0; i < n; ++i) {
+        const int lo = std::max(0, i - w);
+        const int hi = std::min(n - 1, i + w);
+        for(index_t c = 0u; c < series.n_rows; ++c) {
+            value_t mn = series(c, lo), mx = series(c, lo);
+            for(int j = lo + 1; j <= hi; ++j) {
+                mn = std::min(mn, series(c, j));
+                mx = std::max(mx, series(c, j));
+            }
+            lower(c, i) = mn;
+            upper(c, i) = mx;
+        }
+    }
+}
+
+value_t lb_keogh(const mat& query, const mat& lower, const mat& upper)
+{
+    BOOST_ASSERT(query.n_rows == lower.n_rows && query.n_cols == lower.n_cols);
+    BOOST_ASSERT(query.n_rows == upper.n_rows && query.n_cols == upper.n_cols);
+
+    value_t sum = 0.0;
+    const value_t* q = query.memptr();
+    const value_t* l = lower.memptr();
+    const value_t* u = upper.memptr();
+    for(index_t i = 0u; i < query.n_elem; ++i) {
+        if(q[i] > u[i])
+            sum += (q[i] - u[i]) * (q[i] - u[i]);
+        else if(q[i] < l[i])
+            sum += (l[i] - q[i]) * (l[i] - q[i]);
+    }
+    return sum;
+}
+
+DtwMatcher::DtwMatcher(int band /*= -1*/)
+    : band_(band)
+{
+}
+
+int DtwMatcher::add_template(const mat& pattern)
+{
+    BOOST_ASSERT(pattern.n_cols > 0);
+    BOOST_ASSERT(templates_.empty() || templates_[0].series.n_rows == pattern.n_rows);
+
+    Template t;
+    t.series = pattern;
+    dtw_envelope(pattern, band_, t.lower, t.upper);
+    templates_.push_back(t);
+
+    return templates_.size() - 1;
+}
+
+void DtwMatcher::search(const mat& query, int first, int last, std::atomic<value_t>* shared_best,
+                        Match& best, Stats& stats) const
+{
+    for(int i = first; i < last; ++i) {
+        const Template& t = templates_[i];
+
+        // ߳ҵľŸģ, ֻϸģ, ֤ͬʱ
+        // СģȻ
+        const value_t other = shared_best != nullptr ? shared_best->load(std::memory_order_relaxed) : INF;
+        auto pruned = [&best, other](value_t bound) { return bound >= best.distance || bound > other; };
+
+        if(pruned(lb_kim(query, t.series))) {
+            ++stats.kim_pruned;
+            continue;
+        }
+
+        // ͬʱqueryÿһֻ֡ܺģbandΧڵ֡Ӧ
+        if(query.n_cols == t.series.n_cols && pruned(lb_keogh(query, t.lower, t.upper))) {
+            ++stats.keogh_pruned;
+            continue;
+        }
+
+        value_t d = dtw_distance(query, t.series, band_, std::min(best.distance, other));
+        if(d == INF) {
+            ++stats.abandoned;
+            continue;
+        }
+
+        ++stats.computed;
+        if(d < best.distance) {
+            best.index = i;
+            best.distance = d;
+            if(shared_best != nullptr)
+                publish_distance(*shared_best, d);
+        }
+    }
+}
+
+DtwMatcher::Match DtwMatcher::best_match(const mat& query, int n_threads /*= 1*/,
+                                         Stats* stats /*= nullptr*/) const
+{
+    BOOST_ASSERT(n_threads >= 1);
+    BOOST_ASSERT(templates_.empty() || query.n_rows == templates_[0].series.n_rows);
+    BOOST_ASSERT(query.n_cols > 0);
+
+    const int n = templates_.size();
+    if(n_threads > n)
+        n_threads = std::max(n, 1);
+
+    // ÿһ߳һģв, ͨshared_bestʹ߳Ѿҵľ֦,
+    // ̵߳˳ϲ, ͬȡСģ
+    std::atomic<value_t> shared_best(INF);
+    std::atomic<value_t>* shared = n_threads > 1 ? &shared_best : nullptr;
+    std::vector<Match> parts(n_threads);
+    std::vector<Stats> part_stats(n_threads);
+    auto search_part = [this, &query, shared, &parts, &part_stats](int part, index_t first, index_t last) {
+        search(query, first, last, shared, parts[part], part_stats[part]);
+    };
+    parallel_parts(n, n_threads, search_part);
+
+    Match res = parts[0];
+    for(int part = 1; part < n_threads; ++part) {
+        if(parts[part].distance < res.distance)
+            res = parts[part];
+    }
+
+    if(stats != nullptr) {
+        for(int part = 0; part < n_threads; ++part)
+            merge_stats(*stats, part_stats[part]);
+    }
+
+    return res;
+}
+
+std::vector<DtwMatcher::Match> DtwMatcher::best_matches(const std::vector<mat>& queries,
+                                                        int n_threads /*= 1*/,
+                                                        Stats* stats /*= nullptr*/) const
+{
+    BOOST_ASSERT(n_threads >= 1);
+
+    const int n = queries.size();
+    std::vector<Match> res(n);
+    if(n == 0)
+        return res;
+
+    if(n_threads > n)
+        n_threads = n;
+
+    std::vector<Stats> part_stats(n_threads);
+    auto search_part = [this, &queries, &res, &part_stats](int part, index_t first, index_t last) {
+        for(index_t q = first; q < last; ++q)
+            res[q] = best_match(queries[q], 1, &part_stats[part]);
+    };
+    parallel_parts(n, n_threads, search_part);
+
+    if(stats != nullptr) {
+        for(int part = 0; part < n_threads; ++part)
+            merge_stats(*stats, part_stats[part]);
+    }
+
+    return res;
+}
+
+}
@@ -0,0 +1,142 @@
+#include "real_fft.h"
+
+#include <map>
+#include <utility>
+#include <mutex>
+#include <new>
+
+#include <boost/assert.hpp>
+
+#include "fftw3.h"
+#include "wavelet2d.h"
+
+namespace smfe
+{
+namespace fft
+{
+namespace
+{
+// fftwplanner̰߳ȫ, ɺټƻĲҪ
+std::mutex& planner_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+void lock_planner() { planner_mutex().lock(); }
+
+void unlock_planner() { planner_mutex().unlock(); }
+
+// wavelet2dconvfftÿһεöɺټƻ, main֮ǰעͬһ, ֤߲ͬʱʹplanner
+struct ConvfftPlannerLock {
+    ConvfftPlannerLock() { set_convfft_planner_lock(&lock_planner, &unlock_planner); }
+} g_convfft_planner_lock;
+
+typedef std::map<std::pair<int, int>, std::shared_ptr<const RealFftPlan> > PlanCache;
+
+PlanCache& plan_cache()
+{
+    // ȹ, ֤˳ʱеļƻ֮ǰ
+    planner_mutex();
+    static PlanCache cache;
+    return cache;
+}
+
+unsigned int g_planner_flags = FFTW_ESTIMATE;
+}
+
+void set_planner_flags(unsigned int flags)
+{
+    PlanCache old_plans;
+    {
+        std::lock_guard<std::mutex> lock(planner_mutex());
+        g_planner_flags = flags;
+        old_plans.swap(plan_cache());
+    }
+    // ƻҪ, ͷ
+}
+
+unsigned int planner_flags()
+{
+    std::lock_guard<std::mutex> lock(planner_mutex());
+    return g_planner_flags;
+}
+
+void* aligned_malloc(std::size_t bytes)
+{
+    void* p = fftw_malloc(bytes > 0 ? bytes : 1);
+    if(p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void aligned_free(void* p)
+{
+    if(p != nullptr)
+        fftw_free(p);
+}
+
+bool import_wisdom(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(planner_mutex());
+    return fftw_import_wisdom_from_filename(path.c_str()) != 0;
+}
+
+bool export_wisdom(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(planner_mutex());
+    return fftw_export_wisdom_to_filename(path.c_str()) != 0;
+}
+
+RealFftPlan::RealFftPlan(int size, int howmany)
+    : size_(size), howmany_(howmany), plan_(nullptr)
+{
+    const int n_bins = size / 2 + 1;
+    AlignedBuffer<value_t> in(size * howmany);
+    AlignedBuffer<complex_t> out(n_bins * howmany);
+
+    if(howmany == 1) {
+        plan_ = fftw_plan_dft_r2c_1d(size, in.data(), reinterpret_cast<fftw_complex*>(out.data()),
+                                     g_planner_flags);
+    } else {
+        plan_ = fftw_plan_many_dft_r2c(1, &size, howmany,
+                                       in.data(), nullptr, 1, size,
+                                       reinterpret_cast<fftw_complex*>(out.data()), nullptr, 1, n_bins,
+                                       g_planner_flags);
+    }
+
+    if(plan_ == nullptr)
+        throw SMFEException("can not create fft plan");
+}
+
+RealFftPlan::~RealFftPlan()
+{
+    std::lock_guard<std::mutex> lock(planner_mutex());
+    fftw_destroy_plan(plan_);
+}
+
+std::shared_ptr<const RealFftPlan> RealFftPlan::get(int size, int howmany /*= 1*/)
+{
+    BOOST_ASSERT(size > 0 && howmany > 0);
+
+    PlanCache& cache = plan_cache();
+    std::lock_guard<std::mutex> lock(planner_mutex());
+
+    const std::pair<int, int> key(size, howmany);
+    auto ite = cache.find(key);
+    if(ite != cache.end())
+        return ite->second;
+
+    std::shared_ptr<const RealFftPlan> plan(new RealFftPlan(size, howmany));
+    cache[key] = plan;
+    return plan;
+}
+
+void RealFftPlan::execute(value_t* in, complex_t* out) const
+{
+    // new-array execute ̰߳ȫ
+    fftw_execute_dft_r2c(plan_, in, reinterpret_cast<fftw_complex*>(out));
+}
+
+}
+}
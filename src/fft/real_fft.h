@@ -0,0 +1,128 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef REAL_FFT_H__
+#define REAL_FFT_H__
+
+#include "smfe/global.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+struct fftw_plan_s;
+
+namespace smfe
+{
+namespace fft
+{
+
+/** ʹfftw_mallocڴ, ֤ͼƻʱʹõ뷽ʽһ */
+void* aligned_malloc(std::size_t bytes);
+void aligned_free(void* p);
+
+/** ļеfftwwisdom, ֮ɵļƻֱʹ @return Ƿɹ */
+bool import_wisdom(const std::string& path);
+
+/** ѵǰ̻۵wisdom浽ļ @return Ƿɹ */
+bool export_wisdom(const std::string& path);
+
+/**
+ * @brief ֮ɼƻʹõfftw planner־(FFTW_ESTIMATE, FFTW_MEASURE)
+ *
+ * Ѿļƻᱻ, ֮һʹÿһȵʱʹµı־.
+ * ʹþɼƻĶӰ.
+ */
+void set_planner_flags(unsigned int flags);
+
+/** ǰfftw planner־, ĬΪFFTW_ESTIMATE */
+unsigned int planner_flags();
+
+/**
+ * Ļ, ֻҪռʱ·
+ */
+template<typename T>
+class AlignedBuffer
+{
+public:
+    explicit AlignedBuffer(std::size_t n = 0) : data_(nullptr), size_(0) { resize(n); }
+    ~AlignedBuffer() { aligned_free(data_); }
+
+    void resize(std::size_t n)
+    {
+        if(n <= size_)
+            return;
+
+        aligned_free(data_);
+        data_ = static_cast<T*>(aligned_malloc(n * sizeof(T)));
+        size_ = n;
+    }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+    T& operator[](std::size_t i) { return data_[i]; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+
+private:
+    AlignedBuffer(const AlignedBuffer&);
+    AlignedBuffer& operator=(const AlignedBuffer&);
+
+    T* data_;
+    std::size_t size_;
+};
+
+/**
+ * ʵfftƻ, ͬһȵļƻֻһ
+ *
+ * һƻͬʱhowmanyŵͬȵ, ݵĽҲ.
+ *
+ * ƻ֮޸, ߳̿ͬʱʹͬһƻ(ÿһ߳ʹԼĻ)
+ */
+class RealFftPlan
+{
+public:
+    /**
+     * @brief õΪsizeļƻ, һʹõʱ
+     *
+     * @param size ÿһݵĳ @pre size > 0
+     * @param howmany һμݸ @pre howmany > 0
+     */
+    static std::shared_ptr<const RealFftPlan> get(int size, int howmany = 1);
+
+    ~RealFftPlan();
+
+    int size() const { return size_; }
+
+    int howmany() const { return howmany_; }
+
+    /** ÿһƵʸ size/2 + 1 */
+    int n_bins() const { return size_ / 2 + 1; }
+
+    /**
+     * @brief fft, ֻǸƵʲ
+     *
+     * @param in Ϊ size*howmany , вᱻ޸
+     * @param out Ϊ n_bins*howmany 
+     *
+     * @pre inout AlignedBuffer 
+     */
+    void execute(value_t* in, complex_t* out) const;
+
+private:
+    RealFftPlan(int size, int howmany);
+
+    RealFftPlan(const RealFftPlan&);
+    RealFftPlan& operator=(const RealFftPlan&);
+
+    int size_;
+    int howmany_;
+    fftw_plan_s* plan_;
+};
+
+}
+}
+
+#endif // REAL_FFT_H__
@@ -0,0 +1,89 @@
+#include "smfe/fft_config.h"
+
+#include <boost/assert.hpp>
+
+#include "fftw3.h"
+#include "wavelet2d.h"
+
+#include "fft/real_fft.h"
+
+namespace smfe
+{
+namespace
+{
+std::string& saved_wisdom_path()
+{
+    static std::string path;
+    return path;
+}
+
+unsigned int planner_flags_of(FftPlanningLevel level)
+{
+    switch(level) {
+    case FFT_MEASURE:
+        return FFTW_MEASURE;
+    case FFT_PATIENT:
+        return FFTW_PATIENT;
+    case FFT_EXHAUSTIVE:
+        return FFTW_EXHAUSTIVE;
+    default:
+        return FFTW_ESTIMATE;
+    }
+}
+}
+
+bool fft_init(const std::string& wisdom_path, FftPlanningLevel level /*= FFT_MEASURE*/)
+{
+    const unsigned int flags = planner_flags_of(level);
+    fft::set_planner_flags(flags);
+    set_convfft_planner_flags(flags);
+
+    saved_wisdom_path() = wisdom_path;
+    if(wisdom_path.empty())
+        return false;
+
+    return fft::import_wisdom(wisdom_path);
+}
+
+FftPlanningLevel fft_planning_level()
+{
+    switch(fft::planner_flags()) {
+    case FFTW_MEASURE:
+        return FFT_MEASURE;
+    case FFTW_PATIENT:
+        return FFT_PATIENT;
+    case FFTW_EXHAUSTIVE:
+        return FFT_EXHAUSTIVE;
+    default:
+        return FFT_ESTIMATE;
+    }
+}
+
+void fft_prepare(const std::vector<int>& sizes)
+{
+    for(size_t i = 0u; i < sizes.size(); ++i) {
+        BOOST_ASSERT(sizes[i] > 0);
+        fft::RealFftPlan::get(sizes[i]);
+    }
+}
+
+bool fft_save_wisdom()
+{
+    const std::string& path = saved_wisdom_path();
+    if(path.empty())
+        return false;
+
+    return fft::export_wisdom(path);
+}
+
+bool fft_import_wisdom(const std::string& path)
+{
+    return fft::import_wisdom(path);
+}
+
+bool fft_export_wisdom(const std::string& path)
+{
+    return fft::export_wisdom(path);
+}
+
+}
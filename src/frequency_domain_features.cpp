@@ -7,9 +7,41 @@ using namespace std;
 
 #include <boost/assert.hpp>
 
+#include "fft/real_fft.h"
+#include "kernel/signal_kernels.h"
+#include "parallel_parts.h"
+
 namespace smfe
 {
 
+namespace
+{
+// ʱÿһμ, ƻĸ
+const index_t FFT_BATCH_BLOCK = 32;
+
+typedef std::shared_ptr<const fft::RealFftPlan> PlanPtr;
+
+// block_plan һμ FFT_BATCH_BLOCK , tail_plan һblock(ûеʱΪ)
+void fft_batch_columns(const mat& windows, index_t first, index_t last,
+                       const PlanPtr& block_plan, const PlanPtr& tail_plan, cx_mat& res)
+{
+    const index_t size = windows.n_rows;
+    const index_t n_bins = res.n_rows;
+
+    fft::AlignedBuffer<value_t> in(size * FFT_BATCH_BLOCK);
+    fft::AlignedBuffer<complex_t> out(n_bins * FFT_BATCH_BLOCK);
+
+    for(index_t col = first; col < last; col += FFT_BATCH_BLOCK) {
+        const index_t count = std::min(FFT_BATCH_BLOCK, last - col);
+        const fft::RealFftPlan& plan = count == FFT_BATCH_BLOCK ? *block_plan : *tail_plan;
+
+        std::copy(windows.colptr(col), windows.colptr(col) + size * count, in.data());
+        plan.execute(in.data(), out.data());
+        std::copy(out.data(), out.data() + n_bins * count, res.colptr(col));
+    }
+}
+}
+
 inline bool operator< (const complex_t& lhs, const complex_t& rhs)
 {
 	return abs(lhs) < abs(rhs);
@@ -29,12 +61,14 @@ fm_vec frequency_magnitude_vec(const cx_vec& spectrum, value_t fs)
     size_t half_size = spectrum.size()/2 + 1;
     fm_vec res(half_size);
 
-	int i = 0u;
-	res[i].mag = abs(spectrum[i]) / size;
-	res[i].fre = (value_t)(i) * fs / size;
+    // std::complex ֤ʵ鲿
+    vec mags(half_size);
+    kernel::signal_kernels().magnitude(reinterpret_cast<const value_t*>(spectrum.memptr()),
+                                       half_size, 2.0 / size, mags.memptr());
+    mags[0] /= 2;
 
-    for(i = 1; i < half_size; ++i) {
-        res[i].mag = 2 * abs(spectrum[i]) / size;
+    for(size_t i = 0u; i < half_size; ++i) {
+        res[i].mag = mags[i];
         res[i].fre = (value_t)(i) * fs / size;
     }
 
@@ -99,7 +133,120 @@ value_t frequency_domain_entropy(const fm_vec& fm_vector, int nbins)
 
 cx_vec smfe_fft(const vec& source)
 {
-    return arma::fft(source);
+    return smfe_fft(source, source.size());
+}
+
+cx_vec smfe_fft(const vec& source, int n_fft)
+{
+    BOOST_ASSERT(n_fft >= 0 && (index_t)(n_fft) >= source.size());
+
+    if(n_fft == 0)
+        return cx_vec();
+
+    auto plan = fft::RealFftPlan::get(n_fft);
+    const int n_bins = plan->n_bins();
+
+    fft::AlignedBuffer<value_t> in(n_fft);
+    fft::AlignedBuffer<complex_t> out(n_bins);
+
+    std::copy(source.begin(), source.end(), in.data());
+    std::fill(in.data() + source.size(), in.data() + n_fft, 0.0);
+    plan->execute(in.data(), out.data());
+
+    // ʵźŵƵ׹Գ, ֻ˷ǸƵʲ
+    cx_vec res(n_fft);
+    for(int i = 0; i < n_bins; ++i)
+        res[i] = out[i];
+    for(int i = n_bins; i < n_fft; ++i)
+        res[i] = conj(out[n_fft - i]);
+
+    return res;
+}
+
+cx_mat smfe_fft_batch(const mat& windows, int n_threads /*= 1*/)
+{
+    BOOST_ASSERT(n_threads >= 1);
+
+    if(windows.n_rows == 0)
+        return cx_mat();
+
+    const index_t n_cols = windows.n_cols;
+    cx_mat res(windows.n_rows / 2 + 1, n_cols);
+    if(n_cols == 0)
+        return res;
+
+    if(n_threads > (int)n_cols)
+        n_threads = n_cols;
+
+    // ڷ䵽֮߳ǰõҪļƻ, ɼƻʧܵʱֱڵǰ߳׳
+    const int size = windows.n_rows;
+    PlanPtr block_plan;
+    if(n_cols >= FFT_BATCH_BLOCK)
+        block_plan = fft::RealFftPlan::get(size, FFT_BATCH_BLOCK);
+
+    std::vector<PlanPtr> tail_plans(n_threads);
+    for(int part = 0; part < n_threads; ++part) {
+        index_t first, last;
+        part_range(n_cols, n_threads, part, first, last);
+        const index_t tail = (last - first) % FFT_BATCH_BLOCK;
+        if(tail > 0)
+            tail_plans[part] = fft::RealFftPlan::get(size, tail);
+    }
+
+    // ÿһ̼߳һ, длصĲ
+    auto compute_part = [&](int part, index_t first, index_t last) {
+        fft_batch_columns(windows, first, last, block_plan, tail_plans[part], res);
+    };
+    parallel_parts(n_cols, n_threads, compute_part);
+
+    return res;
+}
+
+mat frequency_magnitude_mat(const mat& windows, int n_threads /*= 1*/)
+{
+    BOOST_ASSERT(windows.n_rows > 0);
+
+    cx_mat spectrum = smfe_fft_batch(windows, n_threads);
+
+    // , һμȫķֵ
+    mat res(spectrum.n_rows, spectrum.n_cols);
+    kernel::signal_kernels().magnitude(reinterpret_cast<const value_t*>(spectrum.memptr()),
+                                       spectrum.n_elem, 2.0 / windows.n_rows, res.memptr());
+    res.row(0) /= 2;
+
+    return res;
+}
+
+int fft_fast_size(int n)
+{
+    BOOST_ASSERT(n >= 0);
+
+    for(int size = (n > 1 ? n : 1); ; ++size) {
+        int m = size;
+        const int factors[] = {2, 3, 5, 7};
+        for(int i = 0; i < 4; ++i) {
+            while(m % factors[i] == 0)
+                m /= factors[i];
+        }
+        if(m == 1)
+            return size;
+    }
+}
+
+fm_vec padded_frequency_magnitude_vec(const vec& source, value_t fs, int n_fft /*= 0*/)
+{
+    BOOST_ASSERT(!source.empty());
+
+    if(n_fft == 0)
+        n_fft = fft_fast_size(source.size());
+
+    // frequency_magnitude_vec ղ0֮ĳȹһ, ҪΪԭʼźŵĳ
+    fm_vec res = frequency_magnitude_vec(smfe_fft(source, n_fft), fs);
+    const value_t scale = (value_t)(n_fft) / source.size();
+    for(size_t i = 0u; i < res.size(); ++i)
+        res[i].mag *= scale;
+
+    return res;
 }
 
 vec smfe_ifft(const cx_vec& source)
@@ -0,0 +1,134 @@
+#include "smfe/feature/gyro_integration.h"
+
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+#include "parallel_parts.h"
+
+namespace smfe
+{
+namespace
+{
+// v' = v + w*t + q x t, t = 2 * (q x v),  rotate_3dvec ļͬ
+inline void rotate(const value_t* q, const value_t* v, value_t* out)
+{
+    value_t tx = 2 * (q[2] * v[2] - q[3] * v[1]);
+    value_t ty = 2 * (q[3] * v[0] - q[1] * v[2]);
+    value_t tz = 2 * (q[1] * v[1] - q[2] * v[0]);
+    out[0] = v[0] + q[0] * tx + (q[2] * tz - q[3] * ty);
+    out[1] = v[1] + q[0] * ty + (q[3] * tx - q[1] * tz);
+    out[2] = v[2] + q[0] * tz + (q[1] * ty - q[2] * tx);
+}
+
+// q = q * exp(theta / 2), theta Ϊֲµת, תĽǶ
+inline value_t compose(value_t* q, const value_t* theta)
+{
+    value_t angle = std::sqrt(theta[0] * theta[0] + theta[1] * theta[1] + theta[2] * theta[2]);
+
+    // sin(angle/2)/angle, ǶȺСʱʹ̩չ
+    value_t w, s;
+    if(angle < 1e-4) {
+        w = 1.0 - angle * angle / 8;
+        s = 0.5 - angle * angle / 48;
+    } else {
+        w = std::cos(angle / 2);
+        s = std::sin(angle / 2) / angle;
+    }
+    const value_t x = s * theta[0], y = s * theta[1], z = s * theta[2];
+
+    value_t r[4];
+    r[0] = q[0] * w - q[1] * x - q[2] * y - q[3] * z;
+    r[1] = q[0] * x + q[1] * w + q[2] * z - q[3] * y;
+    r[2] = q[0] * y - q[1] * z + q[2] * w + q[3] * x;
+    r[3] = q[0] * z + q[1] * y - q[2] * x + q[3] * w;
+
+    // ÿһһ, ۼ֮Ԫǵλ
+    const value_t norm = std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3]);
+    for(int c = 0; c < 4; ++c)
+        q[c] = r[c] / norm;
+
+    return angle;
+}
+
+void integrate(const mat& amg_mat, index_t first, index_t last, value_t delta, const vec& init_rot,
+               GyroIntegration& res)
+{
+    value_t q[4] = { 1.0, 0.0, 0.0, 0.0 };
+    if(!init_rot.empty()) {
+        for(int c = 0; c < 4; ++c)
+            q[c] = init_rot[c];
+    }
+
+    value_t angle[3] = { 0.0, 0.0, 0.0 };
+    value_t total_angle = 0.0;
+
+    // ֻת
+    value_t last_global[3];
+    rotate(q, amg_mat.colptr(first) + 6, last_global);
+
+    for(index_t i = first + 1; i <= last; ++i) {
+        const value_t* prev = amg_mat.colptr(i - 1) + 6;
+        const value_t* gyro = amg_mat.colptr(i) + 6;
+
+        value_t theta[3];
+        for(int c = 0; c < 3; ++c)
+            theta[c] = (prev[c] + gyro[c]) / 2 * delta;
+        total_angle += compose(q, theta);
+
+        value_t global[3];
+        rotate(q, gyro, global);
+        for(int c = 0; c < 3; ++c) {
+            angle[c] += (last_global[c] + global[c]) / 2 * delta;
+            last_global[c] = global[c];
+        }
+    }
+
+    res.rotation.set_size(4);
+    for(int c = 0; c < 4; ++c)
+        res.rotation[c] = q[c];
+    res.angle.set_size(3);
+    for(int c = 0; c < 3; ++c)
+        res.angle[c] = angle[c];
+    res.total_angle = total_angle;
+}
+}
+
+GyroIntegration integrate_gyro(const mat& amg_mat, value_t delta, const vec& init_rot /*= vec()*/)
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9 && amg_mat.n_cols > 0);
+    BOOST_ASSERT(init_rot.empty() || init_rot.size() == 4);
+
+    GyroIntegration res;
+    integrate(amg_mat, 0, amg_mat.n_cols - 1, delta, init_rot, res);
+    return res;
+}
+
+std::vector<GyroIntegration> integrate_gyro_windows(const mat& amg_mat, const index_pair_vec& windows,
+                                                    value_t delta, const vec& init_rot /*= vec()*/,
+                                                    int n_threads /*= 1*/)
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9);
+    BOOST_ASSERT(init_rot.empty() || init_rot.size() == 4);
+    BOOST_ASSERT(n_threads >= 1);
+
+    const int n_windows = windows.size();
+    std::vector<GyroIntegration> res(n_windows);
+    if(n_windows == 0)
+        return res;
+    if(n_threads > n_windows)
+        n_threads = n_windows;
+
+    // ÿһ̼߳һ鴰, ֱдӦλ
+    auto integrate_part = [&](int /*part*/, index_t first, index_t last) {
+        for(index_t w = first; w < last; ++w) {
+            BOOST_ASSERT(windows[w].first <= windows[w].second && windows[w].second < amg_mat.n_cols);
+            integrate(amg_mat, windows[w].first, windows[w].second, delta, init_rot, res[w]);
+        }
+    };
+    parallel_parts(n_windows, n_threads, integrate_part);
+
+    return res;
+}
+
+}
@@ -0,0 +1,142 @@
+#include "smfe/feature/histogram_entropy.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+#include "kernel/signal_kernels.h"
+
+namespace smfe
+{
+namespace
+{
+const value_t LOG_2 = std::log(2.0);
+
+inline int clamp_bin(int index, int nbins)
+{
+    return index >= nbins ? nbins - 1 : (index < 0 ? 0 : index);
+}
+
+// ֱͼϢ : -sum(p*log2(p)) = log2(n) - sum(c*log2(c))/n
+value_t entropy_of_count(const int* count, int nbins, index_t n)
+{
+    value_t sum = 0.0;
+    for(int i = 0; i < nbins; ++i) {
+        if(count[i] > 0)
+            sum += count[i] * std::log((value_t)count[i]);
+    }
+
+    return (std::log((value_t)n) - sum / n) / LOG_2;
+}
+}
+
+HistogramEntropy::HistogramEntropy(int nbins)
+    : nbins_(nbins), count_(nbins > 0 ? nbins : 0, 0)
+{
+    BOOST_ASSERT(nbins > 0);
+}
+
+value_t HistogramEntropy::operator()(const value_t* data, index_t n)
+{
+    BOOST_ASSERT(n > 0);
+
+    std::fill(count_.begin(), count_.end(), 0);
+
+    const kernel::SignalKernels& k = kernel::signal_kernels();
+
+    value_t min_v = 0.0, max_v = 0.0;
+    k.min_max(data, n, min_v, max_v);
+
+    // ݶͬ, ȫһ
+    if(!(max_v > min_v)) {
+        count_[0] = n;
+        return 0.0;
+    }
+
+    value_t inv_bin_size = nbins_ / (max_v - min_v);
+    k.histogram(data, n, min_v, inv_bin_size, nbins_, &count_[0]);
+
+    return entropy_of_count(&count_[0], nbins_, n);
+}
+
+value_t HistogramEntropy::operator()(const vec& source)
+{
+    return (*this)(source.memptr(), source.size());
+}
+
+vec HistogramEntropy::operator()(const mat& windows)
+{
+    vec res(windows.n_cols);
+    for(index_t i = 0u; i < windows.n_cols; ++i)
+        res[i] = (*this)(windows.colptr(i), windows.n_rows);
+    return res;
+}
+
+SlidingEntropy::SlidingEntropy(int window_size, int nbins, value_t min_v, value_t max_v)
+    : nbins_(nbins), min_v_(min_v), inv_bin_size_(nbins / (max_v - min_v)),
+      bins_(window_size > 0 ? window_size : 0), count_(nbins > 0 ? nbins : 0, 0),
+      c_log_c_(bins_.size() + 1, 0.0), sum_c_log_c_(0.0), head_(0), count_in_window_(0)
+{
+    BOOST_ASSERT(window_size > 0);
+    BOOST_ASSERT(nbins > 0);
+    BOOST_ASSERT(max_v > min_v);
+
+    for(size_t c = 1u; c < c_log_c_.size(); ++c)
+        c_log_c_[c] = c * std::log((value_t)c) / LOG_2;
+}
+
+int SlidingEntropy::bin_of(value_t value) const
+{
+    return clamp_bin(static_cast<int>(std::floor((value - min_v_) * inv_bin_size_)), nbins_);
+}
+
+void SlidingEntropy::push(value_t value)
+{
+    const index_t window = bins_.size();
+    int bin = bin_of(value);
+
+    if(count_in_window_ == window) {
+        // Ƴɵ
+        int old_bin = bins_[head_];
+        sum_c_log_c_ += c_log_c_[count_[old_bin]-1] - c_log_c_[count_[old_bin]];
+        --count_[old_bin];
+
+        bins_[head_] = bin;
+        head_ = (head_ + 1) % window;
+    } else {
+        bins_[(head_ + count_in_window_) % window] = bin;
+        ++count_in_window_;
+    }
+
+    sum_c_log_c_ += c_log_c_[count_[bin]+1] - c_log_c_[count_[bin]];
+    ++count_[bin];
+}
+
+void SlidingEntropy::push(const vec& data)
+{
+    for(index_t i = 0u; i < data.size(); ++i)
+        push(data[i]);
+}
+
+void SlidingEntropy::clear()
+{
+    std::fill(count_.begin(), count_.end(), 0);
+    sum_c_log_c_ = 0.0;
+    head_ = 0;
+    count_in_window_ = 0;
+}
+
+value_t SlidingEntropy::entropy() const
+{
+    if(count_in_window_ == 0)
+        return 0.0;
+
+    value_t n = (value_t)count_in_window_;
+    value_t res = std::log(n) / LOG_2 - sum_c_log_c_ / n;
+
+    // ۼӹе
+    return res > 0.0 ? res : 0.0;
+}
+
+}
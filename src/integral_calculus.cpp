@@ -1,4 +1,8 @@
 #include "smfe/feature/integral_calculus.h"
+#include "kernel/reduce_kernels.h"
+#include "kernel/signal_kernels.h"
+
+#include <cmath>
 
 namespace smfe {
 
@@ -8,39 +12,128 @@ value_t integration(vec const& data, int degree /*= 2*/)
 
     BOOST_ASSERT(degree >= 2 && degree <= 4);
 
+    return kernel::newton_cotes_sum(data.memptr(), data.size(), degree, false);
+}
+
+value_t integration(vec const& data, vec const& delta_vec)
+{
+    CHECK_VALUE_TYPE(data);
+    CHECK_VALUE_TYPE(delta_vec);
+
+    BOOST_ASSERT(data.size() - 1 == delta_vec.size());
+
     value_t sum = 0.0;
 
-    for(size_t i = degree-1; i < data.size() - (degree-1); ++i)
-        sum += data[i];
+    for(size_t i = 0u; i < data.size() - 1; ++i)
+        sum += (data[i] + data[i+1]) / 2 * delta_vec[i];
 
-    if(degree == 2) {
-        sum += (data[0] + data[data.size()-1])/2;
-    }
+    return sum;
+}
 
-    if(degree == 3) {
-        sum += (data[0] + 5*data[1] + 5*data[data.size()-2] + data[data.size()-1]) / 6;
-    }
+namespace {
 
-    if(degree == 4) {
-        sum += (data[0] + 4*data[1] + 7*data[2] + 7*data[data.size()-3] + 4*data[data.size()-2] + data[data.size()-1]) / 8;
+// ڵx[0..m)ϲֵʽtֵ
+value_t lagrange_value(const value_t* x, const value_t* y, int m, value_t t)
+{
+    value_t res = 0.0;
+    for(int j = 0; j < m; ++j) {
+        value_t l = 1.0;
+        for(int k = 0; k < m; ++k) {
+            if(k != j)
+                l *= (t - x[k]) / (x[j] - x[k]);
+        }
+        res += l * y[j];
     }
+    return res;
+}
 
-    return sum;
 }
 
-value_t integration(vec const& data, vec const& delta_vec)
+vec cumulative_integration(vec const& data, value_t delta /*= 1.0*/, int degree /*= 2*/, value_t init /*= 0.0*/)
+{
+    CHECK_VALUE_TYPE(data);
+
+    BOOST_ASSERT(degree >= 2 && degree <= 4);
+    BOOST_ASSERT(data.size() > 0);
+
+    vec res(data.size());
+    kernel::cumulative_newton_cotes(data.memptr(), 1, data.size(), degree, delta, init, res.memptr(), 1);
+    return res;
+}
+
+vec cumulative_integration(vec const& data, vec const& delta_vec, int degree /*= 2*/, value_t init /*= 0.0*/)
 {
     CHECK_VALUE_TYPE(data);
     CHECK_VALUE_TYPE(delta_vec);
 
-    BOOST_ASSERT(data.size() - 1 == delta_vec.size());
+    BOOST_ASSERT(degree >= 2 && degree <= 4);
+    BOOST_ASSERT(data.size() > 0 && data.size() - 1 == delta_vec.size());
 
-    value_t sum = 0.0;
+    const index_t n = data.size();
+    if((index_t)degree > n)
+        degree = n < 2 ? 2 : n;
 
-    for(size_t i = 0u; i < data.size() - 1; ++i)
-        sum += (data[i] + data[i+1]) / 2 * delta_vec[i];
+    vec times(n);
+    times[0] = 0.0;
+    for(index_t i = 1; i < n; ++i)
+        times[i] = times[i-1] + delta_vec[i-1];
 
-    return sum;
+    // Gauss-LegendreʽµĶʽǾȷ
+    const value_t g = 0.5 / std::sqrt(3.0);
+
+    vec res(n);
+    res[0] = init;
+    value_t sum = init;
+    for(index_t i = 0u; i + 1 < n; ++i) {
+        value_t area;
+        if(degree == 2) {
+            //  integration(data, delta_vec) ͬ
+            area = (data[i] + data[i+1]) / 2 * delta_vec[i];
+        } else {
+            // ֵڵĵһ, ˵ʹõ
+            index_t first = i > 0 ? i - 1 : 0;
+            if(first + degree > n)
+                first = n - degree;
+
+            const value_t h = delta_vec[i];
+            const value_t mid = times[i] + h / 2;
+            area = h / 2 * (lagrange_value(times.memptr() + first, data.memptr() + first, degree, mid - g * h)
+                            + lagrange_value(times.memptr() + first, data.memptr() + first, degree, mid + g * h));
+        }
+
+        sum += area;
+        res[i+1] = sum;
+    }
+
+    return res;
+}
+
+void cumulative_integration_rows(mat& data, value_t delta /*= 1.0*/, int degree /*= 2*/)
+{
+    BOOST_ASSERT(degree >= 2 && degree <= 4);
+
+    if(data.n_cols == 0)
+        return;
+
+    // д, ÿһ֮ļΪ
+    for(index_t r = 0u; r < data.n_rows; ++r) {
+        value_t* row = data.memptr() + r;
+        kernel::cumulative_newton_cotes(row, data.n_rows, data.n_cols, degree, delta, 0.0, row, data.n_rows);
+    }
+}
+
+void cumulative_trajectory(vec const& data, vec& first, vec& second, value_t delta /*= 1.0*/, int degree /*= 2*/,
+                           value_t init_first /*= 0.0*/, value_t init_second /*= 0.0*/)
+{
+    CHECK_VALUE_TYPE(data);
+
+    BOOST_ASSERT(degree >= 2 && degree <= 4);
+    BOOST_ASSERT(data.size() > 0);
+
+    first.set_size(data.size());
+    second.set_size(data.size());
+    kernel::cumulative_newton_cotes(data.memptr(), 1, data.size(), degree, delta, init_first, first.memptr(), 1);
+    kernel::cumulative_newton_cotes(first.memptr(), 1, first.size(), degree, delta, init_second, second.memptr(), 1);
 }
 
 }
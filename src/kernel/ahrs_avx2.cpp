@@ -0,0 +1,92 @@
+// ļʹAVX2 + FMAѡ (ο src/CMakeLists.txt)
+#include "ahrs_kernels.h"
+
+#if defined(SMFE_HAVE_AVX2) && defined(__AVX2__)
+
+#include "madgwick_step.h"
+
+#include <immintrin.h>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+// 4豸һ,  madgwick_step ʹ
+struct Lanes {
+    __m256d v;
+    Lanes(double x) : v(_mm256_set1_pd(x)) {}
+    Lanes(__m256d x) : v(x) {}
+};
+
+struct Mask {
+    __m256d v;
+};
+
+inline Lanes operator+(Lanes a, Lanes b) { return _mm256_add_pd(a.v, b.v); }
+inline Lanes operator-(Lanes a, Lanes b) { return _mm256_sub_pd(a.v, b.v); }
+inline Lanes operator*(Lanes a, Lanes b) { return _mm256_mul_pd(a.v, b.v); }
+inline Lanes operator/(Lanes a, Lanes b) { return _mm256_div_pd(a.v, b.v); }
+inline Lanes sqrt(Lanes a) { return _mm256_sqrt_pd(a.v); }
+
+inline Mask is_positive(Lanes a)
+{
+    Mask m = { _mm256_cmp_pd(a.v, _mm256_setzero_pd(), _CMP_GT_OQ) };
+    return m;
+}
+
+inline Lanes select(Mask m, Lanes a, Lanes b) { return _mm256_blendv_pd(b.v, a.v, m.v); }
+
+// һδ4豸, amgͨgather
+void avx2_madgwick(value_t* q, const value_t* amg, index_t n, value_t beta, value_t dt)
+{
+    const __m128i amg_index = _mm_setr_epi32(0, 9, 18, 27);
+    const Lanes vbeta(beta), vdt(dt);
+
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        const value_t* f = amg + 9 * i;
+        Lanes c[9] = {
+            _mm256_i32gather_pd(f + 0, amg_index, 8), _mm256_i32gather_pd(f + 1, amg_index, 8),
+            _mm256_i32gather_pd(f + 2, amg_index, 8), _mm256_i32gather_pd(f + 3, amg_index, 8),
+            _mm256_i32gather_pd(f + 4, amg_index, 8), _mm256_i32gather_pd(f + 5, amg_index, 8),
+            _mm256_i32gather_pd(f + 6, amg_index, 8), _mm256_i32gather_pd(f + 7, amg_index, 8),
+            _mm256_i32gather_pd(f + 8, amg_index, 8)
+        };
+
+        Lanes q0 = _mm256_loadu_pd(q + i);
+        Lanes q1 = _mm256_loadu_pd(q + n + i);
+        Lanes q2 = _mm256_loadu_pd(q + 2 * n + i);
+        Lanes q3 = _mm256_loadu_pd(q + 3 * n + i);
+
+        madgwick_step(q0, q1, q2, q3, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8],
+                      vbeta, vdt);
+
+        _mm256_storeu_pd(q + i, q0.v);
+        _mm256_storeu_pd(q + n + i, q1.v);
+        _mm256_storeu_pd(q + 2 * n + i, q2.v);
+        _mm256_storeu_pd(q + 3 * n + i, q3.v);
+    }
+
+    // ʣ豸
+    for(; i < n; ++i) {
+        const value_t* f = amg + 9 * i;
+        madgwick_step(q[i], q[n+i], q[2*n+i], q[3*n+i],
+                      f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], beta, dt);
+    }
+}
+}
+
+const AhrsKernels& avx2_ahrs_kernels()
+{
+    static const AhrsKernels kernels = {
+        "avx2", avx2_madgwick
+    };
+    return kernels;
+}
+
+}
+}
+
+#endif // SMFE_HAVE_AVX2
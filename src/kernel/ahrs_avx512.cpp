@@ -0,0 +1,92 @@
+// ļʹAVX512F + FMAѡ (ο src/CMakeLists.txt)
+#include "ahrs_kernels.h"
+
+#if defined(SMFE_HAVE_AVX512) && defined(__AVX512F__)
+
+#include "madgwick_step.h"
+
+#include <immintrin.h>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+// 8豸һ,  madgwick_step ʹ
+struct Lanes {
+    __m512d v;
+    Lanes(double x) : v(_mm512_set1_pd(x)) {}
+    Lanes(__m512d x) : v(x) {}
+};
+
+struct Mask {
+    __mmask8 k;
+};
+
+inline Lanes operator+(Lanes a, Lanes b) { return _mm512_add_pd(a.v, b.v); }
+inline Lanes operator-(Lanes a, Lanes b) { return _mm512_sub_pd(a.v, b.v); }
+inline Lanes operator*(Lanes a, Lanes b) { return _mm512_mul_pd(a.v, b.v); }
+inline Lanes operator/(Lanes a, Lanes b) { return _mm512_div_pd(a.v, b.v); }
+inline Lanes sqrt(Lanes a) { return _mm512_sqrt_pd(a.v); }
+
+inline Mask is_positive(Lanes a)
+{
+    Mask m = { _mm512_cmp_pd_mask(a.v, _mm512_setzero_pd(), _CMP_GT_OQ) };
+    return m;
+}
+
+inline Lanes select(Mask m, Lanes a, Lanes b) { return _mm512_mask_blend_pd(m.k, b.v, a.v); }
+
+// һδ8豸, amgͨgather
+void avx512_madgwick(value_t* q, const value_t* amg, index_t n, value_t beta, value_t dt)
+{
+    const __m256i amg_index = _mm256_setr_epi32(0, 9, 18, 27, 36, 45, 54, 63);
+    const Lanes vbeta(beta), vdt(dt);
+
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        const value_t* f = amg + 9 * i;
+        Lanes c[9] = {
+            _mm512_i32gather_pd(amg_index, f + 0, 8), _mm512_i32gather_pd(amg_index, f + 1, 8),
+            _mm512_i32gather_pd(amg_index, f + 2, 8), _mm512_i32gather_pd(amg_index, f + 3, 8),
+            _mm512_i32gather_pd(amg_index, f + 4, 8), _mm512_i32gather_pd(amg_index, f + 5, 8),
+            _mm512_i32gather_pd(amg_index, f + 6, 8), _mm512_i32gather_pd(amg_index, f + 7, 8),
+            _mm512_i32gather_pd(amg_index, f + 8, 8)
+        };
+
+        Lanes q0 = _mm512_loadu_pd(q + i);
+        Lanes q1 = _mm512_loadu_pd(q + n + i);
+        Lanes q2 = _mm512_loadu_pd(q + 2 * n + i);
+        Lanes q3 = _mm512_loadu_pd(q + 3 * n + i);
+
+        madgwick_step(q0, q1, q2, q3, c[0], c[1], c[2], c[3], c[4], c[5], c[6], c[7], c[8],
+                      vbeta, vdt);
+
+        _mm512_storeu_pd(q + i, q0.v);
+        _mm512_storeu_pd(q + n + i, q1.v);
+        _mm512_storeu_pd(q + 2 * n + i, q2.v);
+        _mm512_storeu_pd(q + 3 * n + i, q3.v);
+    }
+
+    // ʣ豸
+    for(; i < n; ++i) {
+        const value_t* f = amg + 9 * i;
+        madgwick_step(q[i], q[n+i], q[2*n+i], q[3*n+i],
+                      f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], beta, dt);
+    }
+}
+}
+
+const AhrsKernels& avx512_ahrs_kernels()
+{
+    static const AhrsKernels kernels = {
+        "avx512", avx512_madgwick
+    };
+    return kernels;
+}
+
+}
+}
+
+#endif // SMFE_HAVE_AVX512
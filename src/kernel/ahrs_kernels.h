@@ -0,0 +1,50 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef AHRS_KERNELS_H__
+#define AHRS_KERNELS_H__
+
+#include "kernel_types.h"
+
+namespace smfe
+{
+namespace kernel
+{
+
+/**
+ * ̬Ƶkernel, ÿһָӦһʵ @sa MadgwickAhrsBank
+ */
+struct AhrsKernels {
+    const char* isa;    /**< ָ */
+
+    /**
+     * n豸ͬʱһMadgwick, ʵÿһlaneһ豸
+     *
+     * @param q 4*n Ԫ, ֿ: q[0, n) Ϊw, q[n, 2n) Ϊx, 
+     * @param amg 9*n amg, ÿһ豸һ֡, 
+     * @param beta ݶ½Ĳ
+     * @param dt 
+     */
+    void (*madgwick)(value_t* q, const value_t* amg, index_t n, value_t beta, value_t dt);
+};
+
+const AhrsKernels& scalar_ahrs_kernels();
+
+#ifdef SMFE_HAVE_AVX2
+const AhrsKernels& avx2_ahrs_kernels();
+#endif
+
+#ifdef SMFE_HAVE_AVX512
+const AhrsKernels& avx512_ahrs_kernels();
+#endif
+
+/**
+ * ǰѡָһkernel @sa active_isa
+ */
+const AhrsKernels& ahrs_kernels();
+
+}
+}
+
+#endif // AHRS_KERNELS_H__
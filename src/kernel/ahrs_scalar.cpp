@@ -0,0 +1,29 @@
+#include "ahrs_kernels.h"
+#include "madgwick_step.h"
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+void scalar_madgwick(value_t* q, const value_t* amg, index_t n, value_t beta, value_t dt)
+{
+    for(index_t i = 0; i < n; ++i) {
+        const value_t* f = amg + 9 * i;
+        madgwick_step(q[i], q[n+i], q[2*n+i], q[3*n+i],
+                      f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], beta, dt);
+    }
+}
+}
+
+const AhrsKernels& scalar_ahrs_kernels()
+{
+    static const AhrsKernels kernels = {
+        "scalar", scalar_madgwick
+    };
+    return kernels;
+}
+
+}
+}
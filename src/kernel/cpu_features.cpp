@@ -0,0 +1,82 @@
+#include "cpu_features.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define SMFE_X86_CPU
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#define SMFE_X86_CPU
+#endif
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+#ifdef SMFE_X86_CPU
+void cpuid(int leaf, int subleaf, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, leaf, subleaf);
+    for(int i = 0; i < 4; ++i)
+        regs[i] = (unsigned int)info[i];
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+unsigned long long xgetbv0()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((unsigned long long)edx << 32) | eax;
+#endif
+}
+#endif
+
+CpuFeatures detect_cpu_features()
+{
+    CpuFeatures res = { false, false };
+
+#ifdef SMFE_X86_CPU
+    unsigned int regs[4];
+    cpuid(0, 0, regs);
+    if(regs[0] < 7)
+        return res;
+
+    cpuid(1, 0, regs);
+    bool has_osxsave = (regs[2] & (1u << 27)) != 0;
+    bool has_fma = (regs[2] & (1u << 12)) != 0;
+    if(!has_osxsave)
+        return res;
+
+    // ϵͳҪymm(Լzmm)Ĵ״̬
+    unsigned long long xcr0 = xgetbv0();
+    bool os_avx = (xcr0 & 0x6) == 0x6;
+    bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+    cpuid(7, 0, regs);
+    bool has_avx2 = (regs[1] & (1u << 5)) != 0;
+    bool has_avx512f = (regs[1] & (1u << 16)) != 0;
+
+    res.avx2 = os_avx && has_avx2 && has_fma;
+    res.avx512 = res.avx2 && os_avx512 && has_avx512f;
+#endif
+
+    return res;
+}
+}
+
+const CpuFeatures& cpu_features()
+{
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+}
+}
@@ -0,0 +1,29 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef CPU_FEATURES_H__
+#define CPU_FEATURES_H__
+
+namespace smfe
+{
+namespace kernel
+{
+
+/**
+ * ǰcpuͲϵͳͬʱֵָ֧
+ */
+struct CpuFeatures {
+    bool avx2;      /**< AVX2 + FMA */
+    bool avx512;    /**< AVX-512F */
+};
+
+/**
+ * ⵱ǰcpuָ, ڵһεʱ㲢
+ */
+const CpuFeatures& cpu_features();
+
+}
+}
+
+#endif // CPU_FEATURES_H__
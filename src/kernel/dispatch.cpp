@@ -0,0 +1,262 @@
+#include "smfe/cpu_dispatch.h"
+#include "ahrs_kernels.h"
+#include "reduce_kernels.h"
+#include "signal_kernels.h"
+#include "cpu_features.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+namespace
+{
+CpuIsa detect_isa()
+{
+    const kernel::CpuFeatures& features = kernel::cpu_features();
+    (void)features;
+
+#ifdef SMFE_HAVE_AVX512
+    if(features.avx512)
+        return ISA_AVX512;
+#endif
+
+#ifdef SMFE_HAVE_AVX2
+    if(features.avx2)
+        return ISA_AVX2;
+#endif
+
+    return ISA_SCALAR;
+}
+
+// ʱѡ, Ա SMFE_ISA Ƶ͵ָ
+CpuIsa startup_isa()
+{
+    CpuIsa isa = detected_isa();
+
+    const char* env = std::getenv("SMFE_ISA");
+    if(env != nullptr && *env != '\0') {
+        try {
+            CpuIsa limit = isa_from_string(env);
+            if(limit < isa)
+                isa = limit;
+        } catch(const std::invalid_argument&) {
+            // ЧֱӺ, ʹü⵽ָ
+        }
+    }
+
+    return isa;
+}
+
+std::atomic<int>& active_isa_storage()
+{
+    static std::atomic<int> isa(startup_isa());
+    return isa;
+}
+
+// ʱѡkernel, ǵȵһε
+const CpuIsa startup_selection = active_isa();
+}
+
+CpuIsa detected_isa()
+{
+    static const CpuIsa isa = detect_isa();
+    return isa;
+}
+
+CpuIsa active_isa()
+{
+    return static_cast<CpuIsa>(active_isa_storage().load(std::memory_order_relaxed));
+}
+
+void set_active_isa(CpuIsa isa)
+{
+    if(isa < ISA_SCALAR || isa > detected_isa())
+        throw SMFEException(std::string(isa_name(isa)) + " is not supported by current cpu");
+
+    active_isa_storage().store(isa, std::memory_order_relaxed);
+}
+
+void reset_active_isa()
+{
+    active_isa_storage().store(startup_isa(), std::memory_order_relaxed);
+}
+
+const char* isa_name(CpuIsa isa)
+{
+    switch(isa) {
+    case ISA_SCALAR:
+        return "scalar";
+    case ISA_AVX2:
+        return "avx2";
+    case ISA_AVX512:
+        return "avx512";
+    }
+
+    return "unknown";
+}
+
+CpuIsa isa_from_string(const std::string& str)
+{
+    if(str == "scalar")
+        return ISA_SCALAR;
+    if(str == "avx2")
+        return ISA_AVX2;
+    if(str == "avx512")
+        return ISA_AVX512;
+
+    throw std::invalid_argument(str + " is not a valid isa");
+}
+
+namespace kernel
+{
+const ReduceKernels& reduce_kernels()
+{
+    switch(active_isa()) {
+#ifdef SMFE_HAVE_AVX512
+    case ISA_AVX512:
+        return avx512_reduce_kernels();
+#endif
+#ifdef SMFE_HAVE_AVX2
+    case ISA_AVX2:
+        return avx2_reduce_kernels();
+#endif
+    default:
+        return scalar_reduce_kernels();
+    }
+}
+
+const SignalKernels& signal_kernels()
+{
+    switch(active_isa()) {
+#ifdef SMFE_HAVE_AVX512
+    case ISA_AVX512:
+        return avx512_signal_kernels();
+#endif
+#ifdef SMFE_HAVE_AVX2
+    case ISA_AVX2:
+        return avx2_signal_kernels();
+#endif
+    default:
+        return scalar_signal_kernels();
+    }
+}
+
+const AhrsKernels& ahrs_kernels()
+{
+    switch(active_isa()) {
+#ifdef SMFE_HAVE_AVX512
+    case ISA_AVX512:
+        return avx512_ahrs_kernels();
+#endif
+#ifdef SMFE_HAVE_AVX2
+    case ISA_AVX2:
+        return avx2_ahrs_kernels();
+#endif
+    default:
+        return scalar_ahrs_kernels();
+    }
+}
+
+value_t newton_cotes_sum(const value_t* data, index_t n, int degree, bool take_abs)
+{
+    BOOST_ASSERT(degree >= 2 && degree <= 4);
+    BOOST_ASSERT(n > 0);
+
+    // ݸdegree-1ʱ˵ݲ, degree
+    if((index_t)degree > n + 1)
+        degree = n + 1;
+
+    const ReduceKernels& k = reduce_kernels();
+
+    // м䲿ȨΪ1,  2*(degree-1) ʱص, ûм䲿
+    index_t edge = degree - 1;
+    value_t sum = 0.0;
+    if(n > 2 * edge) {
+        const value_t* mid = data + edge;
+        index_t mid_size = n - 2 * edge;
+        sum = take_abs ? k.sum_abs(mid, mid_size) : k.sum(mid, mid_size);
+    }
+
+    // ˵
+    value_t e[6];
+    for(index_t i = 0; i < edge; ++i) {
+        e[i] = take_abs ? std::fabs(data[i]) : data[i];
+        e[5-i] = take_abs ? std::fabs(data[n-1-i]) : data[n-1-i];
+    }
+
+    if(degree == 2)
+        sum += (e[0] + e[5]) / 2;
+    else if(degree == 3)
+        sum += (e[0] + 5*e[1] + 5*e[4] + e[5]) / 6;
+    else
+        sum += (e[0] + 4*e[1] + 7*e[2] + 7*e[3] + 4*e[4] + e[5]) / 8;
+
+    return sum;
+}
+
+void cumulative_newton_cotes(const value_t* data, index_t stride, index_t n, int degree, value_t delta,
+                             value_t init, value_t* out, index_t out_stride)
+{
+    BOOST_ASSERT(degree >= 2 && degree <= 4);
+    BOOST_ASSERT(n > 0);
+
+    if((index_t)degree > n)
+        degree = n < 2 ? 2 : n;
+
+    // ˵ʹõĲֵʽ, дκν֮ǰȡ(ԭؼʱᱻ)
+    value_t first_area = 0.0, last_area = 0.0;
+    if(degree == 3) {
+        first_area = delta / 12 * (5 * data[0] + 8 * data[stride] - data[2 * stride]);
+    } else if(degree == 4) {
+        first_area = delta / 24 * (9 * data[0] + 19 * data[stride] - 5 * data[2 * stride] + data[3 * stride]);
+        const value_t* tail = data + (n - 4) * stride;
+        last_area = delta / 24 * (tail[0] - 5 * tail[stride] + 19 * tail[2 * stride] + 9 * tail[3 * stride]);
+    }
+
+    // buf[j] Ϊ f[b-1+j], ǰౣһ(degreeΪ4ʱ), Χ֮Ϊ0
+    const index_t block = 256;
+    value_t buf[block + 3];
+    value_t area[block];
+
+    const SignalKernels& k = signal_kernels();
+    const index_t n_areas = n - 1;
+    value_t sum = init;
+
+    buf[0] = 0.0;
+    buf[1] = data[0];
+    buf[2] = n > 1 ? data[stride] : 0.0;
+    out[0] = init;
+
+    for(index_t b = 0; b < n_areas; b += block) {
+        const index_t m = std::min(block, n_areas - b);
+
+        // ǰһ鱣, ԭؼʱǿѾ
+        for(index_t j = 3; j < m + 3; ++j) {
+            index_t idx = b - 1 + j;
+            buf[j] = idx < n ? data[idx * stride] : 0.0;
+        }
+
+        k.newton_cotes_areas(buf + 1, m, degree, delta, area);
+        if(b == 0 && degree >= 3)
+            area[0] = first_area;
+        if(degree == 4 && b + m == n_areas)
+            area[m - 1] = last_area;
+
+        for(index_t i = 0; i < m; ++i) {
+            sum += area[i];
+            out[(b + i + 1) * out_stride] = sum;
+        }
+
+        for(int j = 0; j < 3; ++j)
+            buf[j] = buf[m + j];
+    }
+}
+
+}
+}
@@ -0,0 +1,32 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef KERNEL_TYPES_H__
+#define KERNEL_TYPES_H__
+
+// kernelͷļֻʹ, ܰ smfe/global.h: armadillo ͱ׼쳣
+// ÿһʹAVXѡļһ, ܰAVX-512İ汾ʹ
+
+namespace smfe
+{
+typedef double value_t;         /**<  global.h еĶһ */
+typedef unsigned int index_t;   /**<  global.h еĶһ */
+
+namespace kernel
+{
+namespace
+{
+/**
+ * ͨamgĸ, cλӦamg֡еĵc(ٶ, , ),
+ *  ChannelMask ȡֵһ @sa smfe::channel_count
+ */
+inline int channel_count(int channels)
+{
+    return (channels & 1) + ((channels >> 1) & 1) + ((channels >> 2) & 1);
+}
+}
+}
+}
+
+#endif // KERNEL_TYPES_H__
@@ -0,0 +1,135 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef MADGWICK_STEP_H__
+#define MADGWICK_STEP_H__
+
+#include <cmath>
+
+namespace smfe
+{
+namespace kernel
+{
+// ÿһָkernelļʹòͬıѡ, ռб֤ÿһļʹԼʵ,
+// ᱻϲͬһ(ʵʹAVX512İ汾)
+namespace
+{
+
+inline bool is_positive(double x) { return x > 0.0; }
+
+inline double select(bool mask, double a, double b) { return mask ? a : b; }
+
+/**
+ * Madgwick MARG˲һ, ָͬһݹʽ
+ *
+ * V  double, ҲǶĴİװ, Ҫṩ + - * /, sqrt, Լ
+ * is_positive(x) õ, select(mask, a, b) ѡ.
+ *
+ * ûз֧: ٶΪ0ʱ, ֻ; Ϊ0ʱʹֻмٶȵ.
+ *
+ * ο: S. Madgwick, An efficient orientation filter for inertial and inertial/magnetic
+ * sensor arrays, 2010
+ */
+template<typename V>
+inline void madgwick_step(V& q0, V& q1, V& q2, V& q3,
+                          V ax, V ay, V az, V mx, V my, V mz, V gx, V gy, V gz,
+                          V beta, V dt)
+{
+    using std::sqrt;
+
+    const V zero(0.0), half(0.5), one(1.0), two(2.0), four(4.0), eight(8.0);
+
+    // ǵõԪ仯
+    V qd0 = half * (zero - q1 * gx - q2 * gy - q3 * gz);
+    V qd1 = half * (q0 * gx + q2 * gz - q3 * gy);
+    V qd2 = half * (q0 * gy - q1 * gz + q3 * gx);
+    V qd3 = half * (q0 * gz + q1 * gy - q2 * gx);
+
+    const V a_norm2 = ax * ax + ay * ay + az * az;
+    const V m_norm2 = mx * mx + my * my + mz * mz;
+    const auto a_valid = is_positive(a_norm2);
+    const auto m_valid = is_positive(m_norm2);
+
+    const V ra = one / sqrt(select(a_valid, a_norm2, one));
+    const V rm = one / sqrt(select(m_valid, m_norm2, one));
+    ax = ax * ra; ay = ay * ra; az = az * ra;
+    mx = mx * rm; my = my * rm; mz = mz * rm;
+
+    const V _2q0 = two * q0, _2q1 = two * q1, _2q2 = two * q2, _2q3 = two * q3;
+    const V q0q0 = q0 * q0, q0q1 = q0 * q1, q0q2 = q0 * q2, q0q3 = q0 * q3;
+    const V q1q1 = q1 * q1, q1q2 = q1 * q2, q1q3 = q1 * q3;
+    const V q2q2 = q2 * q2, q2q3 = q2 * q3, q3q3 = q3 * q3;
+
+    // ʹüٶȺʹƵݶ
+    const V _2q0mx = _2q0 * mx, _2q0my = _2q0 * my, _2q0mz = _2q0 * mz, _2q1mx = _2q1 * mx;
+    const V _2q0q2 = _2q0 * q2, _2q2q3 = _2q2 * q3;
+
+    const V hx = mx * q0q0 - _2q0my * q3 + _2q0mz * q2 + mx * q1q1 + _2q1 * my * q2
+                 + _2q1 * mz * q3 - mx * q2q2 - mx * q3q3;
+    const V hy = _2q0mx * q3 + my * q0q0 - _2q0mz * q1 + _2q1mx * q2 - my * q1q1
+                 + my * q2q2 + _2q2 * mz * q3 - my * q3q3;
+    const V _2bx = sqrt(hx * hx + hy * hy);
+    const V _2bz = zero - _2q0mx * q2 + _2q0my * q1 + mz * q0q0 + _2q1mx * q3 - mz * q1q1
+                   + _2q2 * my * q3 - mz * q2q2 + mz * q3q3;
+    const V _4bx = two * _2bx, _4bz = two * _2bz;
+
+    const V fa0 = two * q1q3 - _2q0q2 - ax;
+    const V fa1 = two * q0q1 + _2q2q3 - ay;
+    const V fa2 = one - two * q1q1 - two * q2q2 - az;
+    const V fm0 = _2bx * (half - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx;
+    const V fm1 = _2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my;
+    const V fm2 = _2bx * (q0q2 + q1q3) + _2bz * (half - q1q1 - q2q2) - mz;
+
+    const V ms0 = zero - _2q2 * fa0 + _2q1 * fa1 - _2bz * q2 * fm0
+                  + (_2bz * q1 - _2bx * q3) * fm1 + _2bx * q2 * fm2;
+    const V ms1 = _2q3 * fa0 + _2q0 * fa1 - four * q1 * fa2 + _2bz * q3 * fm0
+                  + (_2bx * q2 + _2bz * q0) * fm1 + (_2bx * q3 - _4bz * q1) * fm2;
+    const V ms2 = zero - _2q0 * fa0 + _2q3 * fa1 - four * q2 * fa2 - (_4bx * q2 + _2bz * q0) * fm0
+                  + (_2bx * q1 + _2bz * q3) * fm1 + (_2bx * q0 - _4bz * q2) * fm2;
+    const V ms3 = _2q1 * fa0 + _2q2 * fa1 + (_2bz * q1 - _4bx * q3) * fm0
+                  + (_2bz * q2 - _2bx * q0) * fm1 + _2bx * q1 * fm2;
+
+    // ֻʹüٶȵݶ
+    const V _4q0 = four * q0, _4q1 = four * q1, _4q2 = four * q2;
+    const V _8q1 = eight * q1, _8q2 = eight * q2;
+
+    const V is0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+    const V is1 = _4q1 * q3q3 - _2q3 * ax + four * q0q0 * q1 - _2q0 * ay - _4q1
+                  + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+    const V is2 = four * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2
+                  + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+    const V is3 = four * q1q1 * q3 - _2q1 * ax + four * q2q2 * q3 - _2q2 * ay;
+
+    V s0 = select(m_valid, ms0, is0);
+    V s1 = select(m_valid, ms1, is1);
+    V s2 = select(m_valid, ms2, is2);
+    V s3 = select(m_valid, ms3, is3);
+
+    // ݶȹһ, ٶЧݶΪ0ʱ
+    const V s_norm2 = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+    const auto s_valid = is_positive(s_norm2);
+    const V rs = select(a_valid, select(s_valid, beta / sqrt(select(s_valid, s_norm2, one)), zero), zero);
+
+    qd0 = qd0 - rs * s0;
+    qd1 = qd1 - rs * s1;
+    qd2 = qd2 - rs * s2;
+    qd3 = qd3 - rs * s3;
+
+    q0 = q0 + qd0 * dt;
+    q1 = q1 + qd1 * dt;
+    q2 = q2 + qd2 * dt;
+    q3 = q3 + qd3 * dt;
+
+    const V rq = one / sqrt(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    q0 = q0 * rq;
+    q1 = q1 * rq;
+    q2 = q2 * rq;
+    q3 = q3 * rq;
+}
+
+}
+}
+}
+
+#endif // MADGWICK_STEP_H__
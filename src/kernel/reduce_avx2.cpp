@@ -0,0 +1,99 @@
+// ļʹAVX2 + FMAѡ (ο src/CMakeLists.txt)
+#include "reduce_kernels.h"
+
+#if defined(SMFE_HAVE_AVX2) && defined(__AVX2__)
+
+#include <cmath>
+#include <immintrin.h>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+inline value_t hsum(__m256d v)
+{
+    __m128d lo = _mm256_castpd256_pd128(v);
+    __m128d hi = _mm256_extractf128_pd(v, 1);
+    lo = _mm_add_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+}
+
+inline __m256d abs_pd(__m256d v)
+{
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+}
+
+value_t avx2_sum(const value_t* data, index_t n)
+{
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        s0 = _mm256_add_pd(s0, _mm256_loadu_pd(data + i));
+        s1 = _mm256_add_pd(s1, _mm256_loadu_pd(data + i + 4));
+    }
+    value_t res = hsum(_mm256_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += data[i];
+    return res;
+}
+
+value_t avx2_sum_sq(const value_t* data, index_t n)
+{
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m256d x0 = _mm256_loadu_pd(data + i);
+        __m256d x1 = _mm256_loadu_pd(data + i + 4);
+        s0 = _mm256_fmadd_pd(x0, x0, s0);
+        s1 = _mm256_fmadd_pd(x1, x1, s1);
+    }
+    value_t res = hsum(_mm256_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += data[i] * data[i];
+    return res;
+}
+
+value_t avx2_sum_abs(const value_t* data, index_t n)
+{
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        s0 = _mm256_add_pd(s0, abs_pd(_mm256_loadu_pd(data + i)));
+        s1 = _mm256_add_pd(s1, abs_pd(_mm256_loadu_pd(data + i + 4)));
+    }
+    value_t res = hsum(_mm256_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += std::fabs(data[i]);
+    return res;
+}
+
+value_t avx2_sum_abs_dev(const value_t* data, index_t n, value_t center)
+{
+    __m256d c = _mm256_set1_pd(center);
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        s0 = _mm256_add_pd(s0, abs_pd(_mm256_sub_pd(_mm256_loadu_pd(data + i), c)));
+        s1 = _mm256_add_pd(s1, abs_pd(_mm256_sub_pd(_mm256_loadu_pd(data + i + 4), c)));
+    }
+    value_t res = hsum(_mm256_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += std::fabs(data[i] - center);
+    return res;
+}
+}
+
+const ReduceKernels& avx2_reduce_kernels()
+{
+    static const ReduceKernels kernels = {
+        "avx2", avx2_sum, avx2_sum_sq, avx2_sum_abs, avx2_sum_abs_dev
+    };
+    return kernels;
+}
+
+}
+}
+
+#endif // SMFE_HAVE_AVX2
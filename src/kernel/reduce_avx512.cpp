@@ -0,0 +1,92 @@
+// ļʹAVX-512Fѡ (ο src/CMakeLists.txt)
+#include "reduce_kernels.h"
+
+#if defined(SMFE_HAVE_AVX512) && defined(__AVX512F__)
+
+#include <cmath>
+#include <immintrin.h>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+inline __m512d abs_pd(__m512d v)
+{
+    return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(v),
+                                                _mm512_set1_epi64(0x7fffffffffffffffLL)));
+}
+
+value_t avx512_sum(const value_t* data, index_t n)
+{
+    __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+    index_t i = 0;
+    for(; i + 16 <= n; i += 16) {
+        s0 = _mm512_add_pd(s0, _mm512_loadu_pd(data + i));
+        s1 = _mm512_add_pd(s1, _mm512_loadu_pd(data + i + 8));
+    }
+    value_t res = _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += data[i];
+    return res;
+}
+
+value_t avx512_sum_sq(const value_t* data, index_t n)
+{
+    __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+    index_t i = 0;
+    for(; i + 16 <= n; i += 16) {
+        __m512d x0 = _mm512_loadu_pd(data + i);
+        __m512d x1 = _mm512_loadu_pd(data + i + 8);
+        s0 = _mm512_fmadd_pd(x0, x0, s0);
+        s1 = _mm512_fmadd_pd(x1, x1, s1);
+    }
+    value_t res = _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += data[i] * data[i];
+    return res;
+}
+
+value_t avx512_sum_abs(const value_t* data, index_t n)
+{
+    __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+    index_t i = 0;
+    for(; i + 16 <= n; i += 16) {
+        s0 = _mm512_add_pd(s0, abs_pd(_mm512_loadu_pd(data + i)));
+        s1 = _mm512_add_pd(s1, abs_pd(_mm512_loadu_pd(data + i + 8)));
+    }
+    value_t res = _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += std::fabs(data[i]);
+    return res;
+}
+
+value_t avx512_sum_abs_dev(const value_t* data, index_t n, value_t center)
+{
+    __m512d c = _mm512_set1_pd(center);
+    __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+    index_t i = 0;
+    for(; i + 16 <= n; i += 16) {
+        s0 = _mm512_add_pd(s0, abs_pd(_mm512_sub_pd(_mm512_loadu_pd(data + i), c)));
+        s1 = _mm512_add_pd(s1, abs_pd(_mm512_sub_pd(_mm512_loadu_pd(data + i + 8), c)));
+    }
+    value_t res = _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+    for(; i < n; ++i)
+        res += std::fabs(data[i] - center);
+    return res;
+}
+}
+
+const ReduceKernels& avx512_reduce_kernels()
+{
+    static const ReduceKernels kernels = {
+        "avx512", avx512_sum, avx512_sum_sq, avx512_sum_abs, avx512_sum_abs_dev
+    };
+    return kernels;
+}
+
+}
+}
+
+#endif // SMFE_HAVE_AVX512
@@ -0,0 +1,62 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef REDUCE_KERNELS_H__
+#define REDUCE_KERNELS_H__
+
+#include "kernel_types.h"
+
+namespace smfe
+{
+namespace kernel
+{
+
+/**
+ * Լkernel, ÿһָӦһʵ
+ *
+ * еkernelֱ, м(ֵĿ)
+ */
+struct ReduceKernels {
+    const char* isa;    /**< ָ */
+
+    /** sum(x) */
+    value_t (*sum)(const value_t* data, index_t n);
+    /** sum(x*x) */
+    value_t (*sum_sq)(const value_t* data, index_t n);
+    /** sum(|x|) */
+    value_t (*sum_abs)(const value_t* data, index_t n);
+    /** sum(|x - center|) */
+    value_t (*sum_abs_dev)(const value_t* data, index_t n, value_t center);
+};
+
+const ReduceKernels& scalar_reduce_kernels();
+
+#ifdef SMFE_HAVE_AVX2
+const ReduceKernels& avx2_reduce_kernels();
+#endif
+
+#ifdef SMFE_HAVE_AVX512
+const ReduceKernels& avx512_reduce_kernels();
+#endif
+
+/**
+ * ǰѡָһkernel @sa active_isa
+ */
+const ReduceKernels& reduce_kernels();
+
+/**
+ * Newton-Cotes ֵļȨ @sa integration
+ *
+ * мȨΪ1, ֻ degree-1 ݵȨزͬ, м䲿ֱʹ sum 
+ * sum_abs kernel .  2*(degree-1) ʱ˵Ȩص, ûм䲿.
+ *
+ * @param take_abs Ϊtrueʱ |x| Ļ, Ҫֵ
+ * @pre 2 <= degree <= 4 && n > 0
+ */
+value_t newton_cotes_sum(const value_t* data, index_t n, int degree, bool take_abs);
+
+}
+}
+
+#endif // REDUCE_KERNELS_H__
@@ -0,0 +1,83 @@
+#include "reduce_kernels.h"
+
+#include <cmath>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+// ʹ4ۼ, ټӷ֮
+
+value_t scalar_sum(const value_t* data, index_t n)
+{
+    value_t s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        s0 += data[i];
+        s1 += data[i+1];
+        s2 += data[i+2];
+        s3 += data[i+3];
+    }
+    for(; i < n; ++i)
+        s0 += data[i];
+    return (s0 + s1) + (s2 + s3);
+}
+
+value_t scalar_sum_sq(const value_t* data, index_t n)
+{
+    value_t s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        s0 += data[i] * data[i];
+        s1 += data[i+1] * data[i+1];
+        s2 += data[i+2] * data[i+2];
+        s3 += data[i+3] * data[i+3];
+    }
+    for(; i < n; ++i)
+        s0 += data[i] * data[i];
+    return (s0 + s1) + (s2 + s3);
+}
+
+value_t scalar_sum_abs(const value_t* data, index_t n)
+{
+    value_t s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        s0 += std::fabs(data[i]);
+        s1 += std::fabs(data[i+1]);
+        s2 += std::fabs(data[i+2]);
+        s3 += std::fabs(data[i+3]);
+    }
+    for(; i < n; ++i)
+        s0 += std::fabs(data[i]);
+    return (s0 + s1) + (s2 + s3);
+}
+
+value_t scalar_sum_abs_dev(const value_t* data, index_t n, value_t center)
+{
+    value_t s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        s0 += std::fabs(data[i] - center);
+        s1 += std::fabs(data[i+1] - center);
+        s2 += std::fabs(data[i+2] - center);
+        s3 += std::fabs(data[i+3] - center);
+    }
+    for(; i < n; ++i)
+        s0 += std::fabs(data[i] - center);
+    return (s0 + s1) + (s2 + s3);
+}
+}
+
+const ReduceKernels& scalar_reduce_kernels()
+{
+    static const ReduceKernels kernels = {
+        "scalar", scalar_sum, scalar_sum_sq, scalar_sum_abs, scalar_sum_abs_dev
+    };
+    return kernels;
+}
+
+}
+}
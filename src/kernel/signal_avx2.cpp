@@ -0,0 +1,236 @@
+// ļʹAVX2 + FMAѡ (ο src/CMakeLists.txt)
+#include "signal_kernels.h"
+
+#if defined(SMFE_HAVE_AVX2) && defined(__AVX2__)
+
+#include <cmath>
+#include <immintrin.h>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+inline int clamp_bin(int index, int nbins)
+{
+    return index >= nbins ? nbins - 1 : (index < 0 ? 0 : index);
+}
+
+// ʹstd::min/max, ģʵͬᱻϲ
+inline double min2(double a, double b) { return b < a ? b : a; }
+inline double max2(double a, double b) { return a < b ? b : a; }
+
+void avx2_min_max(const value_t* data, index_t n, value_t& min_v, value_t& max_v)
+{
+    value_t lo = data[0], hi = data[0];
+    index_t i = 0;
+
+    if(n >= 8) {
+        __m256d vmin0 = _mm256_loadu_pd(data), vmax0 = vmin0;
+        __m256d vmin1 = _mm256_loadu_pd(data + 4), vmax1 = vmin1;
+        for(i = 8; i + 8 <= n; i += 8) {
+            __m256d x0 = _mm256_loadu_pd(data + i);
+            __m256d x1 = _mm256_loadu_pd(data + i + 4);
+            vmin0 = _mm256_min_pd(vmin0, x0); vmax0 = _mm256_max_pd(vmax0, x0);
+            vmin1 = _mm256_min_pd(vmin1, x1); vmax1 = _mm256_max_pd(vmax1, x1);
+        }
+
+        double buf[4];
+        _mm256_storeu_pd(buf, _mm256_min_pd(vmin0, vmin1));
+        lo = min2(min2(buf[0], buf[1]), min2(buf[2], buf[3]));
+        _mm256_storeu_pd(buf, _mm256_max_pd(vmax0, vmax1));
+        hi = max2(max2(buf[0], buf[1]), max2(buf[2], buf[3]));
+    }
+
+    for(; i < n; ++i) {
+        if(data[i] < lo) lo = data[i];
+        if(data[i] > hi) hi = data[i];
+    }
+
+    min_v = lo;
+    max_v = hi;
+}
+
+void avx2_histogram(const value_t* data, index_t n, value_t min_v, value_t inv_bin_size,
+                    int nbins, int* count)
+{
+    __m256d vmin = _mm256_set1_pd(min_v);
+    __m256d vinv = _mm256_set1_pd(inv_bin_size);
+    __m128i vlast = _mm_set1_epi32(nbins - 1);
+    __m128i vzero = _mm_setzero_si128();
+
+    int idx[4];
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(data + i);
+        __m128i bin = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_sub_pd(x, vmin), vinv));
+        bin = _mm_max_epi32(_mm_min_epi32(bin, vlast), vzero);
+        _mm_storeu_si128((__m128i*)idx, bin);
+        ++count[idx[0]]; ++count[idx[1]]; ++count[idx[2]]; ++count[idx[3]];
+    }
+
+    for(; i < n; ++i)
+        ++count[clamp_bin(static_cast<int>((data[i] - min_v) * inv_bin_size), nbins)];
+}
+
+// row[0]*x + row[1]*y + row[2]*z
+inline __m256d dot3(const value_t* row, __m256d x, __m256d y, __m256d z)
+{
+    return _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(row[0]), x),
+                                       _mm256_mul_pd(_mm256_set1_pd(row[1]), y)),
+                         _mm256_mul_pd(_mm256_set1_pd(row[2]), z));
+}
+
+// v = M * (v - b), k ΪдŵMb
+inline void calibrate(const value_t* k, __m256d& v0, __m256d& v1, __m256d& v2)
+{
+    __m256d x = _mm256_sub_pd(v0, _mm256_set1_pd(k[9]));
+    __m256d y = _mm256_sub_pd(v1, _mm256_set1_pd(k[10]));
+    __m256d z = _mm256_sub_pd(v2, _mm256_set1_pd(k[11]));
+
+    v0 = dot3(k, x, y, z);
+    v1 = dot3(k + 3, x, y, z);
+    v2 = dot3(k + 6, x, y, z);
+}
+
+// һת4֡, Ԫͨgather
+void avx2_rotate_amg(const value_t* rot, const value_t* amg, index_t n_frames, int channels,
+                     const value_t* calib, value_t* out)
+{
+    const index_t out_rows = 3 * channel_count(channels);
+    const __m128i rot_index = _mm_setr_epi32(0, 4, 8, 12);
+    const __m128i amg_index = _mm_setr_epi32(0, 9, 18, 27);
+    const __m256d two = _mm256_set1_pd(2.0);
+
+    index_t i = 0;
+    for(; i + 4 <= n_frames; i += 4) {
+        const value_t* q = rot + 4 * i;
+        __m256d w = _mm256_i32gather_pd(q, rot_index, 8);
+        __m256d x = _mm256_i32gather_pd(q + 1, rot_index, 8);
+        __m256d y = _mm256_i32gather_pd(q + 2, rot_index, 8);
+        __m256d z = _mm256_i32gather_pd(q + 3, rot_index, 8);
+
+        index_t offset = 0;
+        for(int c = 0; c < 3; ++c) {
+            if(!(channels & (1 << c)))
+                continue;
+
+            const value_t* v = amg + 9 * i + 3 * c;
+            __m256d v0 = _mm256_i32gather_pd(v, amg_index, 8);
+            __m256d v1 = _mm256_i32gather_pd(v + 1, amg_index, 8);
+            __m256d v2 = _mm256_i32gather_pd(v + 2, amg_index, 8);
+            if(calib != nullptr)
+                calibrate(calib + 12 * c, v0, v1, v2);
+
+            __m256d tx = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(y, v2), _mm256_mul_pd(z, v1)));
+            __m256d ty = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(z, v0), _mm256_mul_pd(x, v2)));
+            __m256d tz = _mm256_mul_pd(two, _mm256_sub_pd(_mm256_mul_pd(x, v1), _mm256_mul_pd(y, v0)));
+
+            __m256d r[3];
+            r[0] = _mm256_add_pd(_mm256_add_pd(v0, _mm256_mul_pd(w, tx)),
+                                 _mm256_sub_pd(_mm256_mul_pd(y, tz), _mm256_mul_pd(z, ty)));
+            r[1] = _mm256_add_pd(_mm256_add_pd(v1, _mm256_mul_pd(w, ty)),
+                                 _mm256_sub_pd(_mm256_mul_pd(z, tx), _mm256_mul_pd(x, tz)));
+            r[2] = _mm256_add_pd(_mm256_add_pd(v2, _mm256_mul_pd(w, tz)),
+                                 _mm256_sub_pd(_mm256_mul_pd(x, ty), _mm256_mul_pd(y, tx)));
+
+            // AVX2ûscatterָ, дٰ֡д
+            double buf[3][4];
+            for(int k = 0; k < 3; ++k)
+                _mm256_storeu_pd(buf[k], r[k]);
+            for(int f = 0; f < 4; ++f) {
+                value_t* o = out + out_rows * (i + f) + offset;
+                o[0] = buf[0][f]; o[1] = buf[1][f]; o[2] = buf[2][f];
+            }
+            offset += 3;
+        }
+    }
+
+    if(i < n_frames)
+        scalar_signal_kernels().rotate_amg(rot + 4 * i, amg + 9 * i, n_frames - i, channels, calib,
+                                           out + out_rows * i);
+}
+
+void avx2_magnitude(const value_t* spectrum, index_t n, value_t scale, value_t* mag)
+{
+    __m256d vscale = _mm256_set1_pd(scale);
+    index_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+        __m256d x0 = _mm256_loadu_pd(spectrum + 2 * i);
+        __m256d x1 = _mm256_loadu_pd(spectrum + 2 * i + 4);
+        // haddĽ˳Ϊ [0, 2, 1, 3], Ҫ
+        __m256d s = _mm256_hadd_pd(_mm256_mul_pd(x0, x0), _mm256_mul_pd(x1, x1));
+        s = _mm256_permute4x64_pd(s, 0xd8);
+        _mm256_storeu_pd(mag + i, _mm256_mul_pd(vscale, _mm256_sqrt_pd(s)));
+    }
+
+    for(; i < n; ++i) {
+        value_t re = spectrum[2*i], im = spectrum[2*i+1];
+        mag[i] = scale * std::sqrt(re * re + im * im);
+    }
+}
+
+void avx2_moving_average(const value_t* data, index_t n_out, int width, value_t* out)
+{
+    __m256d vwidth = _mm256_set1_pd((value_t)width);
+    index_t i = 0;
+    for(; i + 4 <= n_out; i += 4) {
+        __m256d sum = _mm256_setzero_pd();
+        for(int k = 0; k < width; ++k)
+            sum = _mm256_add_pd(sum, _mm256_loadu_pd(data + i + k));
+        _mm256_storeu_pd(out + i, _mm256_div_pd(sum, vwidth));
+    }
+
+    if(i < n_out)
+        scalar_signal_kernels().moving_average(data + i, n_out - i, width, out + i);
+}
+
+void avx2_newton_cotes_areas(const value_t* f, index_t n_areas, int degree, value_t scale, value_t* area)
+{
+    // ͱʵʹͬ˳
+    index_t i = 0;
+    if(degree == 2) {
+        const __m256d c = _mm256_set1_pd(scale / 2);
+        for(; i + 4 <= n_areas; i += 4) {
+            __m256d s = _mm256_add_pd(_mm256_loadu_pd(f + i), _mm256_loadu_pd(f + i + 1));
+            _mm256_storeu_pd(area + i, _mm256_mul_pd(c, s));
+        }
+    } else if(degree == 3) {
+        const __m256d c = _mm256_set1_pd(scale / 12);
+        const __m256d w0 = _mm256_set1_pd(8.0), w1 = _mm256_set1_pd(5.0);
+        for(; i + 4 <= n_areas; i += 4) {
+            __m256d s = _mm256_mul_pd(w0, _mm256_loadu_pd(f + i));
+            s = _mm256_sub_pd(s, _mm256_loadu_pd(f + i - 1));
+            s = _mm256_add_pd(s, _mm256_mul_pd(w1, _mm256_loadu_pd(f + i + 1)));
+            _mm256_storeu_pd(area + i, _mm256_mul_pd(c, s));
+        }
+    } else {
+        const __m256d c = _mm256_set1_pd(scale / 24);
+        const __m256d w0 = _mm256_set1_pd(13.0);
+        for(; i + 4 <= n_areas; i += 4) {
+            __m256d s = _mm256_mul_pd(w0, _mm256_add_pd(_mm256_loadu_pd(f + i), _mm256_loadu_pd(f + i + 1)));
+            s = _mm256_sub_pd(s, _mm256_loadu_pd(f + i - 1));
+            s = _mm256_sub_pd(s, _mm256_loadu_pd(f + i + 2));
+            _mm256_storeu_pd(area + i, _mm256_mul_pd(c, s));
+        }
+    }
+
+    if(i < n_areas)
+        scalar_signal_kernels().newton_cotes_areas(f + i, n_areas - i, degree, scale, area + i);
+}
+}
+
+const SignalKernels& avx2_signal_kernels()
+{
+    static const SignalKernels kernels = {
+        "avx2", avx2_min_max, avx2_histogram, avx2_rotate_amg, avx2_magnitude,
+        avx2_moving_average, avx2_newton_cotes_areas
+    };
+    return kernels;
+}
+
+}
+}
+
+#endif // SMFE_HAVE_AVX2
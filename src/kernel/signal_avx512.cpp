@@ -0,0 +1,230 @@
+// ļʹAVX-512Fѡ (ο src/CMakeLists.txt)
+#include "signal_kernels.h"
+
+#if defined(SMFE_HAVE_AVX512) && defined(__AVX512F__)
+
+#include <cmath>
+#include <immintrin.h>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+inline int clamp_bin(int index, int nbins)
+{
+    return index >= nbins ? nbins - 1 : (index < 0 ? 0 : index);
+}
+
+void avx512_min_max(const value_t* data, index_t n, value_t& min_v, value_t& max_v)
+{
+    value_t lo = data[0], hi = data[0];
+    index_t i = 0;
+
+    if(n >= 16) {
+        __m512d vmin0 = _mm512_loadu_pd(data), vmax0 = vmin0;
+        __m512d vmin1 = _mm512_loadu_pd(data + 8), vmax1 = vmin1;
+        for(i = 16; i + 16 <= n; i += 16) {
+            __m512d x0 = _mm512_loadu_pd(data + i);
+            __m512d x1 = _mm512_loadu_pd(data + i + 8);
+            vmin0 = _mm512_min_pd(vmin0, x0); vmax0 = _mm512_max_pd(vmax0, x0);
+            vmin1 = _mm512_min_pd(vmin1, x1); vmax1 = _mm512_max_pd(vmax1, x1);
+        }
+
+        lo = _mm512_reduce_min_pd(_mm512_min_pd(vmin0, vmin1));
+        hi = _mm512_reduce_max_pd(_mm512_max_pd(vmax0, vmax1));
+    }
+
+    for(; i < n; ++i) {
+        if(data[i] < lo) lo = data[i];
+        if(data[i] > hi) hi = data[i];
+    }
+
+    min_v = lo;
+    max_v = hi;
+}
+
+void avx512_histogram(const value_t* data, index_t n, value_t min_v, value_t inv_bin_size,
+                      int nbins, int* count)
+{
+    __m512d vmin = _mm512_set1_pd(min_v);
+    __m512d vinv = _mm512_set1_pd(inv_bin_size);
+    __m256i vlast = _mm256_set1_epi32(nbins - 1);
+    __m256i vzero = _mm256_setzero_si256();
+
+    int idx[8];
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m512d x = _mm512_loadu_pd(data + i);
+        __m256i bin = _mm512_cvttpd_epi32(_mm512_mul_pd(_mm512_sub_pd(x, vmin), vinv));
+        bin = _mm256_max_epi32(_mm256_min_epi32(bin, vlast), vzero);
+        _mm256_storeu_si256((__m256i*)idx, bin);
+        for(int k = 0; k < 8; ++k)
+            ++count[idx[k]];
+    }
+
+    for(; i < n; ++i)
+        ++count[clamp_bin(static_cast<int>((data[i] - min_v) * inv_bin_size), nbins)];
+}
+
+// row[0]*x + row[1]*y + row[2]*z
+inline __m512d dot3(const value_t* row, __m512d x, __m512d y, __m512d z)
+{
+    return _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(_mm512_set1_pd(row[0]), x),
+                                       _mm512_mul_pd(_mm512_set1_pd(row[1]), y)),
+                         _mm512_mul_pd(_mm512_set1_pd(row[2]), z));
+}
+
+// v = M * (v - b), k ΪдŵMb
+inline void calibrate(const value_t* k, __m512d& v0, __m512d& v1, __m512d& v2)
+{
+    __m512d x = _mm512_sub_pd(v0, _mm512_set1_pd(k[9]));
+    __m512d y = _mm512_sub_pd(v1, _mm512_set1_pd(k[10]));
+    __m512d z = _mm512_sub_pd(v2, _mm512_set1_pd(k[11]));
+
+    v0 = dot3(k, x, y, z);
+    v1 = dot3(k + 3, x, y, z);
+    v2 = dot3(k + 6, x, y, z);
+}
+
+// һת8֡, ʹgather, scatterд
+void avx512_rotate_amg(const value_t* rot, const value_t* amg, index_t n_frames, int channels,
+                       const value_t* calib, value_t* out)
+{
+    const int out_rows = 3 * channel_count(channels);
+    const __m256i rot_index = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    const __m256i amg_index = _mm256_setr_epi32(0, 9, 18, 27, 36, 45, 54, 63);
+    const __m256i out_index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                 _mm256_set1_epi32(out_rows));
+    const __m512d two = _mm512_set1_pd(2.0);
+
+    index_t i = 0;
+    for(; i + 8 <= n_frames; i += 8) {
+        const value_t* q = rot + 4 * i;
+        __m512d w = _mm512_i32gather_pd(rot_index, q, 8);
+        __m512d x = _mm512_i32gather_pd(rot_index, q + 1, 8);
+        __m512d y = _mm512_i32gather_pd(rot_index, q + 2, 8);
+        __m512d z = _mm512_i32gather_pd(rot_index, q + 3, 8);
+
+        index_t offset = 0;
+        for(int c = 0; c < 3; ++c) {
+            if(!(channels & (1 << c)))
+                continue;
+
+            const value_t* v = amg + 9 * i + 3 * c;
+            __m512d v0 = _mm512_i32gather_pd(amg_index, v, 8);
+            __m512d v1 = _mm512_i32gather_pd(amg_index, v + 1, 8);
+            __m512d v2 = _mm512_i32gather_pd(amg_index, v + 2, 8);
+            if(calib != nullptr)
+                calibrate(calib + 12 * c, v0, v1, v2);
+
+            __m512d tx = _mm512_mul_pd(two, _mm512_sub_pd(_mm512_mul_pd(y, v2), _mm512_mul_pd(z, v1)));
+            __m512d ty = _mm512_mul_pd(two, _mm512_sub_pd(_mm512_mul_pd(z, v0), _mm512_mul_pd(x, v2)));
+            __m512d tz = _mm512_mul_pd(two, _mm512_sub_pd(_mm512_mul_pd(x, v1), _mm512_mul_pd(y, v0)));
+
+            __m512d r0 = _mm512_add_pd(_mm512_add_pd(v0, _mm512_mul_pd(w, tx)),
+                                       _mm512_sub_pd(_mm512_mul_pd(y, tz), _mm512_mul_pd(z, ty)));
+            __m512d r1 = _mm512_add_pd(_mm512_add_pd(v1, _mm512_mul_pd(w, ty)),
+                                       _mm512_sub_pd(_mm512_mul_pd(z, tx), _mm512_mul_pd(x, tz)));
+            __m512d r2 = _mm512_add_pd(_mm512_add_pd(v2, _mm512_mul_pd(w, tz)),
+                                       _mm512_sub_pd(_mm512_mul_pd(x, ty), _mm512_mul_pd(y, tx)));
+
+            value_t* o = out + out_rows * i + offset;
+            _mm512_i32scatter_pd(o, out_index, r0, 8);
+            _mm512_i32scatter_pd(o + 1, out_index, r1, 8);
+            _mm512_i32scatter_pd(o + 2, out_index, r2, 8);
+            offset += 3;
+        }
+    }
+
+    if(i < n_frames)
+        scalar_signal_kernels().rotate_amg(rot + 4 * i, amg + 9 * i, n_frames - i, channels, calib,
+                                           out + out_rows * i);
+}
+
+void avx512_magnitude(const value_t* spectrum, index_t n, value_t scale, value_t* mag)
+{
+    const __m512i re_index = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+    const __m512i im_index = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+    __m512d vscale = _mm512_set1_pd(scale);
+
+    index_t i = 0;
+    for(; i + 8 <= n; i += 8) {
+        __m512d x0 = _mm512_loadu_pd(spectrum + 2 * i);
+        __m512d x1 = _mm512_loadu_pd(spectrum + 2 * i + 8);
+        __m512d re = _mm512_permutex2var_pd(x0, re_index, x1);
+        __m512d im = _mm512_permutex2var_pd(x0, im_index, x1);
+        __m512d s = _mm512_add_pd(_mm512_mul_pd(re, re), _mm512_mul_pd(im, im));
+        _mm512_storeu_pd(mag + i, _mm512_mul_pd(vscale, _mm512_sqrt_pd(s)));
+    }
+
+    for(; i < n; ++i) {
+        value_t re = spectrum[2*i], im = spectrum[2*i+1];
+        mag[i] = scale * std::sqrt(re * re + im * im);
+    }
+}
+
+void avx512_moving_average(const value_t* data, index_t n_out, int width, value_t* out)
+{
+    __m512d vwidth = _mm512_set1_pd((value_t)width);
+    index_t i = 0;
+    for(; i + 8 <= n_out; i += 8) {
+        __m512d sum = _mm512_setzero_pd();
+        for(int k = 0; k < width; ++k)
+            sum = _mm512_add_pd(sum, _mm512_loadu_pd(data + i + k));
+        _mm512_storeu_pd(out + i, _mm512_div_pd(sum, vwidth));
+    }
+
+    if(i < n_out)
+        scalar_signal_kernels().moving_average(data + i, n_out - i, width, out + i);
+}
+
+void avx512_newton_cotes_areas(const value_t* f, index_t n_areas, int degree, value_t scale, value_t* area)
+{
+    // ͱʵʹͬ˳
+    index_t i = 0;
+    if(degree == 2) {
+        const __m512d c = _mm512_set1_pd(scale / 2);
+        for(; i + 8 <= n_areas; i += 8) {
+            __m512d s = _mm512_add_pd(_mm512_loadu_pd(f + i), _mm512_loadu_pd(f + i + 1));
+            _mm512_storeu_pd(area + i, _mm512_mul_pd(c, s));
+        }
+    } else if(degree == 3) {
+        const __m512d c = _mm512_set1_pd(scale / 12);
+        const __m512d w0 = _mm512_set1_pd(8.0), w1 = _mm512_set1_pd(5.0);
+        for(; i + 8 <= n_areas; i += 8) {
+            __m512d s = _mm512_mul_pd(w0, _mm512_loadu_pd(f + i));
+            s = _mm512_sub_pd(s, _mm512_loadu_pd(f + i - 1));
+            s = _mm512_add_pd(s, _mm512_mul_pd(w1, _mm512_loadu_pd(f + i + 1)));
+            _mm512_storeu_pd(area + i, _mm512_mul_pd(c, s));
+        }
+    } else {
+        const __m512d c = _mm512_set1_pd(scale / 24);
+        const __m512d w0 = _mm512_set1_pd(13.0);
+        for(; i + 8 <= n_areas; i += 8) {
+            __m512d s = _mm512_mul_pd(w0, _mm512_add_pd(_mm512_loadu_pd(f + i), _mm512_loadu_pd(f + i + 1)));
+            s = _mm512_sub_pd(s, _mm512_loadu_pd(f + i - 1));
+            s = _mm512_sub_pd(s, _mm512_loadu_pd(f + i + 2));
+            _mm512_storeu_pd(area + i, _mm512_mul_pd(c, s));
+        }
+    }
+
+    if(i < n_areas)
+        scalar_signal_kernels().newton_cotes_areas(f + i, n_areas - i, degree, scale, area + i);
+}
+}
+
+const SignalKernels& avx512_signal_kernels()
+{
+    static const SignalKernels kernels = {
+        "avx512", avx512_min_max, avx512_histogram, avx512_rotate_amg, avx512_magnitude,
+        avx512_moving_average, avx512_newton_cotes_areas
+    };
+    return kernels;
+}
+
+}
+}
+
+#endif // SMFE_HAVE_AVX512
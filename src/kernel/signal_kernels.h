@@ -0,0 +1,100 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef SIGNAL_KERNELS_H__
+#define SIGNAL_KERNELS_H__
+
+#include "kernel_types.h"
+
+namespace smfe
+{
+namespace kernel
+{
+
+/**
+ * źŴг˹Լ֮ȵkernel, ÿһָӦһʵ @sa ReduceKernels
+ */
+struct SignalKernels {
+    const char* isa;    /**< ָ */
+
+    /** һαõСֵֵ @pre n > 0 */
+    void (*min_max)(const value_t* data, index_t n, value_t& min_v, value_t& max_v);
+
+    /**
+     * ͳֱͼ, iݵΪ (int)((x - min_v) * inv_bin_size), Χ
+     * ͳƵһһ. count ҪԤ.
+     */
+    void (*histogram)(const value_t* data, index_t n, value_t min_v, value_t inv_bin_size,
+                      int nbins, int* count);
+
+    /**
+     * ʹÿһ֡Ԫתamg֡channelsѡ3d @sa rotate_amg_channels
+     *
+     * @param rot 4*n_frames Ԫ(w, x, y, z), 
+     * @param amg 9*n_frames amg, 
+     * @param channels ҪתĴ @sa ChannelMask
+     * @param calib ת֮ǰУ, ΪnullptrʱУ. ÿһ12: дŵ
+     * 3x3Mƫb, У֮Ϊ M * (v - b) @sa CalibrationModel
+     * @param out (3*channel_count(channels))*n_frames , a, m, g˳ֻѡĴ,
+     * ܺamgص
+     */
+    void (*rotate_amg)(const value_t* rot, const value_t* amg, index_t n_frames, int channels,
+                       const value_t* calib, value_t* out);
+
+    /**
+     * Ƶ׷ֵ mag[i] = scale * |spectrum[i]|
+     *
+     * @param spectrum ŵĸ(ʵ, 鲿), Ϊ2*n
+     */
+    void (*magnitude)(const value_t* spectrum, index_t n, value_t scale, value_t* mag);
+
+    /**
+     * ƽ out[i] = (data[i] + ... + data[i+width-1]) / width, ±С
+     * ˳ۼ, ȫһ @sa mean_filter_get_one_index
+     */
+    void (*moving_average)(const value_t* data, index_t n_out, int width, value_t* out);
+
+    /**
+     * Newton-Cotes ۻÿһ, area[i] Ϊ scale  [i, i+1] ϲֵʽ
+     * Ļ(λ) @sa cumulative_newton_cotes
+     *
+     * degree Ϊ2ʱʹ f[i], f[i+1]; Ϊ3ʱʹ f[i-1], f[i], f[i+1]; Ϊ4ʱʹ
+     * f[i-1] ... f[i+2]. Ҫ f[-1]  f[n_areas+1] Զȡ.
+     */
+    void (*newton_cotes_areas)(const value_t* f, index_t n_areas, int degree, value_t scale, value_t* area);
+};
+
+const SignalKernels& scalar_signal_kernels();
+
+#ifdef SMFE_HAVE_AVX2
+const SignalKernels& avx2_signal_kernels();
+#endif
+
+#ifdef SMFE_HAVE_AVX512
+const SignalKernels& avx512_signal_kernels();
+#endif
+
+/**
+ * ǰѡָһkernel @sa active_isa
+ */
+const SignalKernels& signal_kernels();
+
+/**
+ * Newton-Cotes ۻ out[0] = init, out[i] = out[i-1] +  [i-1, i] 
+ * @sa cumulative_integration
+ *
+ * ݰ鸴ƵĻټ, ļ, out ҲԺ data ͬ
+ * (ԭؼ). ûʹõĲֵʽ, ݸdegreeʱ򽵵ͽ.
+ *
+ * @param data iΪ data[i*stride]
+ * @param out iΪ out[i*out_stride]
+ * @pre 2 <= degree <= 4 && n > 0
+ */
+void cumulative_newton_cotes(const value_t* data, index_t stride, index_t n, int degree, value_t delta,
+                             value_t init, value_t* out, index_t out_stride);
+
+}
+}
+
+#endif // SIGNAL_KERNELS_H__
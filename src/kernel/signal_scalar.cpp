@@ -0,0 +1,131 @@
+#include "signal_kernels.h"
+
+#include <cmath>
+
+namespace smfe
+{
+namespace kernel
+{
+namespace
+{
+inline int clamp_bin(int index, int nbins)
+{
+    return index >= nbins ? nbins - 1 : (index < 0 ? 0 : index);
+}
+
+void scalar_min_max(const value_t* data, index_t n, value_t& min_v, value_t& max_v)
+{
+    value_t lo = data[0], hi = data[0];
+    for(index_t i = 1; i < n; ++i) {
+        if(data[i] < lo) lo = data[i];
+        if(data[i] > hi) hi = data[i];
+    }
+
+    min_v = lo;
+    max_v = hi;
+}
+
+void scalar_histogram(const value_t* data, index_t n, value_t min_v, value_t inv_bin_size,
+                      int nbins, int* count)
+{
+    for(index_t i = 0; i < n; ++i)
+        ++count[clamp_bin(static_cast<int>((data[i] - min_v) * inv_bin_size), nbins)];
+}
+
+// v' = v + w*t + q x t, t = 2 * (q x v),  rotate_3dvec ļͬ
+inline void rotate_one(value_t w, value_t x, value_t y, value_t z, const value_t* v, value_t* out)
+{
+    value_t tx = 2 * (y * v[2] - z * v[1]);
+    value_t ty = 2 * (z * v[0] - x * v[2]);
+    value_t tz = 2 * (x * v[1] - y * v[0]);
+
+    out[0] = v[0] + w * tx + (y * tz - z * ty);
+    out[1] = v[1] + w * ty + (z * tx - x * tz);
+    out[2] = v[2] + w * tz + (x * ty - y * tx);
+}
+
+// out = M * (v - b), k ΪдŵMb
+inline void calibrate_one(const value_t* k, const value_t* v, value_t* out)
+{
+    value_t x = v[0] - k[9], y = v[1] - k[10], z = v[2] - k[11];
+
+    out[0] = k[0] * x + k[1] * y + k[2] * z;
+    out[1] = k[3] * x + k[4] * y + k[5] * z;
+    out[2] = k[6] * x + k[7] * y + k[8] * z;
+}
+
+void scalar_rotate_amg(const value_t* rot, const value_t* amg, index_t n_frames, int channels,
+                       const value_t* calib, value_t* out)
+{
+    const index_t out_rows = 3 * channel_count(channels);
+    for(index_t i = 0; i < n_frames; ++i) {
+        const value_t* q = rot + 4 * i;
+        value_t* o = out + out_rows * i;
+        for(int c = 0; c < 3; ++c) {
+            if(!(channels & (1 << c)))
+                continue;
+
+            const value_t* v = amg + 9 * i + 3 * c;
+            value_t corrected[3];
+            if(calib != nullptr) {
+                calibrate_one(calib + 12 * c, v, corrected);
+                v = corrected;
+            }
+
+            rotate_one(q[0], q[1], q[2], q[3], v, o);
+            o += 3;
+        }
+    }
+}
+
+void scalar_magnitude(const value_t* spectrum, index_t n, value_t scale, value_t* mag)
+{
+    for(index_t i = 0; i < n; ++i) {
+        value_t re = spectrum[2*i], im = spectrum[2*i+1];
+        mag[i] = scale * std::sqrt(re * re + im * im);
+    }
+}
+
+void scalar_moving_average(const value_t* data, index_t n_out, int width, value_t* out)
+{
+    for(index_t i = 0; i < n_out; ++i) {
+        value_t sum = 0;
+        for(int k = 0; k < width; ++k)
+            sum += data[i+k];
+        out[i] = sum / width;
+    }
+}
+
+void scalar_newton_cotes_areas(const value_t* f, index_t n_areas, int degree, value_t scale, value_t* area)
+{
+    if(degree == 2) {
+        const value_t c = scale / 2;
+        for(index_t i = 0; i < n_areas; ++i)
+            area[i] = c * (f[i] + f[i+1]);
+    } else if(degree == 3) {
+        const value_t c = scale / 12;
+        for(index_t i = 0; i < n_areas; ++i) {
+            const value_t* p = f + i;
+            area[i] = c * (8 * p[0] - p[-1] + 5 * p[1]);
+        }
+    } else {
+        const value_t c = scale / 24;
+        for(index_t i = 0; i < n_areas; ++i) {
+            const value_t* p = f + i;
+            area[i] = c * (13 * (p[0] + p[1]) - p[-1] - p[2]);
+        }
+    }
+}
+}
+
+const SignalKernels& scalar_signal_kernels()
+{
+    static const SignalKernels kernels = {
+        "scalar", scalar_min_max, scalar_histogram, scalar_rotate_amg, scalar_magnitude,
+        scalar_moving_average, scalar_newton_cotes_areas
+    };
+    return kernels;
+}
+
+}
+}
@@ -0,0 +1,218 @@
+#include "smfe/feature/mag_calibration.h"
+#include "smfe/feature/calibration.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+namespace
+{
+const int N_PARAMS = 9;
+
+// ԳCholeskyֽ a * x = b, aֻʹǲ
+bool cholesky_solve(const value_t (&a)[N_PARAMS][N_PARAMS], const value_t* b, value_t* x)
+{
+    value_t l[N_PARAMS][N_PARAMS];
+    value_t max_diag = 0.0;
+    for(int i = 0; i < N_PARAMS; ++i)
+        max_diag = std::max(max_diag, a[i][i]);
+    if(max_diag <= 0.0)
+        return false;
+
+    for(int j = 0; j < N_PARAMS; ++j) {
+        value_t d = a[j][j];
+        for(int k = 0; k < j; ++k)
+            d -= l[j][k] * l[j][k];
+
+        // ԪԺСʱΪ(һƽ)
+        if(d <= 1e-12 * max_diag)
+            return false;
+        l[j][j] = std::sqrt(d);
+
+        for(int i = j + 1; i < N_PARAMS; ++i) {
+            value_t s = a[j][i];
+            for(int k = 0; k < j; ++k)
+                s -= l[i][k] * l[j][k];
+            l[i][j] = s / l[j][j];
+        }
+    }
+
+    value_t y[N_PARAMS];
+    for(int i = 0; i < N_PARAMS; ++i) {
+        value_t s = b[i];
+        for(int k = 0; k < i; ++k)
+            s -= l[i][k] * y[k];
+        y[i] = s / l[i][i];
+    }
+    for(int i = N_PARAMS - 1; i >= 0; --i) {
+        value_t s = y[i];
+        for(int k = i + 1; k < N_PARAMS; ++k)
+            s -= l[k][i] * x[k];
+        x[i] = s / l[i][i];
+    }
+    return true;
+}
+
+// 3x3ԳƾJacobiֵֽ a = v * diag(w) * v^T
+void jacobi_eigen(value_t (&a)[3][3], value_t (&w)[3], value_t (&v)[3][3])
+{
+    for(int i = 0; i < 3; ++i) {
+        for(int j = 0; j < 3; ++j)
+            v[i][j] = (i == j ? 1.0 : 0.0);
+    }
+
+    for(int sweep = 0; sweep < 50; ++sweep) {
+        value_t off = std::fabs(a[0][1]) + std::fabs(a[0][2]) + std::fabs(a[1][2]);
+        value_t diag = std::fabs(a[0][0]) + std::fabs(a[1][1]) + std::fabs(a[2][2]);
+        if(off <= 1e-15 * diag)
+            break;
+
+        for(int p = 0; p < 2; ++p) {
+            for(int q = p + 1; q < 3; ++q) {
+                if(a[p][q] == 0.0)
+                    continue;
+
+                // ѡתʹ a[p][q] Ϊ0
+                value_t theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+                value_t t = (theta >= 0 ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1));
+                value_t c = 1 / std::sqrt(t * t + 1), s = t * c;
+
+                for(int k = 0; k < 3; ++k) {
+                    value_t akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for(int k = 0; k < 3; ++k) {
+                    value_t apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for(int k = 0; k < 3; ++k) {
+                    value_t vkp = v[k][p], vkq = v[k][q];
+                    v[k][p] = c * vkp - s * vkq;
+                    v[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    for(int i = 0; i < 3; ++i)
+        w[i] = a[i][i];
+}
+}
+
+MagCalibrationEstimator::MagCalibrationEstimator(value_t forgetting /*= 1.0*/)
+    : forgetting_(forgetting), radius_(1.0)
+{
+    BOOST_ASSERT(forgetting > 0.0 && forgetting <= 1.0);
+
+    offset_.zeros(3);
+    matrix_.eye(3, 3);
+    reset();
+}
+
+void MagCalibrationEstimator::reset()
+{
+    for(int i = 0; i < N_PARAMS; ++i) {
+        for(int j = 0; j < N_PARAMS; ++j)
+            normal_[i][j] = 0.0;
+        rhs_[i] = 0.0;
+    }
+    n_samples_ = 0;
+}
+
+void MagCalibrationEstimator::push(const vec& mag)
+{
+    BOOST_ASSERT(mag.size() == 3);
+
+    const value_t x = mag[0], y = mag[1], z = mag[2];
+    const value_t d[N_PARAMS] = { x * x, y * y, z * z, 2 * x * y, 2 * x * z, 2 * y * z, 2 * x, 2 * y, 2 * z };
+
+    for(int i = 0; i < N_PARAMS; ++i) {
+        for(int j = i; j < N_PARAMS; ++j)
+            normal_[i][j] = forgetting_ * normal_[i][j] + d[i] * d[j];
+        rhs_[i] = forgetting_ * rhs_[i] + d[i];
+    }
+    ++n_samples_;
+}
+
+void MagCalibrationEstimator::push_amg(const mat& amg_mat)
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9);
+
+    vec mag(3);
+    for(index_t i = 0u; i < amg_mat.n_cols; ++i) {
+        const value_t* m = amg_mat.colptr(i) + 3;
+        mag[0] = m[0]; mag[1] = m[1]; mag[2] = m[2];
+        push(mag);
+    }
+}
+
+bool MagCalibrationEstimator::solve()
+{
+    if(n_samples_ < (unsigned long long)N_PARAMS)
+        return false;
+
+    value_t p[N_PARAMS];
+    if(!cholesky_solve(normal_, rhs_, p))
+        return false;
+
+    // v^T A v + 2 b^T v = 1
+    value_t a[3][3] = {
+        { p[0], p[3], p[4] },
+        { p[3], p[1], p[5] },
+        { p[4], p[5], p[2] }
+    };
+    const value_t b[3] = { p[6], p[7], p[8] };
+
+    value_t w[3], v[3][3];
+    value_t e[3][3] = {
+        { a[0][0], a[0][1], a[0][2] },
+        { a[1][0], a[1][1], a[1][2] },
+        { a[2][0], a[2][1], a[2][2] }
+    };
+    jacobi_eigen(e, w, v);
+    if(w[0] <= 0.0 || w[1] <= 0.0 || w[2] <= 0.0)
+        return false;
+
+    //  o = -A^-1 b = -V diag(1/w) V^T b
+    value_t center[3] = { 0.0, 0.0, 0.0 };
+    for(int k = 0; k < 3; ++k) {
+        value_t proj = v[0][k] * b[0] + v[1][k] * b[1] + v[2][k] * b[2];
+        for(int i = 0; i < 3; ++i)
+            center[i] -= v[i][k] * proj / w[k];
+    }
+
+    // (v - o)^T A (v - o) = 1 + o^T A o
+    value_t scale = 1.0;
+    for(int i = 0; i < 3; ++i) {
+        for(int j = 0; j < 3; ++j)
+            scale += center[i] * a[i][j] * center[j];
+    }
+    if(scale <= 0.0)
+        return false;
+
+    // Ϊ sqrt(scale / w), У֮İ뾶ȡƽֵ, Ϊ radius * sqrt(A / scale)
+    value_t radius = std::pow(scale * scale * scale / (w[0] * w[1] * w[2]), 1.0 / 6);
+    for(int i = 0; i < 3; ++i) {
+        offset_[i] = center[i];
+        for(int j = 0; j < 3; ++j) {
+            value_t s = 0.0;
+            for(int k = 0; k < 3; ++k)
+                s += v[i][k] * std::sqrt(w[k] / scale) * v[j][k];
+            matrix_(i, j) = radius * s;
+        }
+    }
+    radius_ = radius;
+    return true;
+}
+
+void MagCalibrationEstimator::apply_to(CalibrationModel& model) const
+{
+    model.set(Mag, matrix_, offset_);
+}
+
+}
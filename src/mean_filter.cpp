@@ -1,5 +1,9 @@
 #include "smfe/feature/mean_filter.h"
 
+#include <algorithm>
+
+#include "kernel/signal_kernels.h"
+
 namespace smfe
 {
 value_t mean_filter_get_one_index(const vec& data, int filter_size, int index)
@@ -26,9 +30,25 @@ vec mean_filter_get_range(const vec& data, int filter_size, int start_index, int
     BOOST_ASSERT(filter_size >= 0);
 
     vec result(end_index - start_index);
-    for(int i = start_index; i != end_index; ++i) {
+
+    //  [filter_size, size-filter_size) ʹkernel, ˵Ĵڻᱻض
+    int full_beg = std::max(start_index, filter_size);
+    int full_end = std::min(end_index, (int)data.size() - filter_size);
+    if(full_beg > full_end)
+        full_beg = full_end = end_index;
+
+    for(int i = start_index; i != full_beg; ++i)
         result[i-start_index] = mean_filter_get_one_index(data, filter_size, i);
+
+    if(full_beg < full_end) {
+        kernel::signal_kernels().moving_average(data.memptr() + full_beg - filter_size,
+                                                full_end - full_beg, 2 * filter_size + 1,
+                                                result.memptr() + full_beg - start_index);
     }
+
+    for(int i = full_end; i != end_index; ++i)
+        result[i-start_index] = mean_filter_get_one_index(data, filter_size, i);
+
     return result;
 }
 
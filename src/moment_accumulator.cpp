@@ -0,0 +1,127 @@
+#include "smfe/feature/moment_accumulator.h"
+
+#include <cmath>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include "parallel_parts.h"
+
+namespace smfe
+{
+MomentAccumulator::MomentAccumulator()
+    : n_(0), mean_(0.0), m2_(0.0), m3_(0.0), m4_(0.0)
+{
+}
+
+void MomentAccumulator::update(value_t value)
+{
+    value_t n1 = (value_t)n_;
+    ++n_;
+    value_t n = (value_t)n_;
+
+    value_t delta = value - mean_;
+    value_t delta_n = delta / n;
+    value_t delta_n2 = delta_n * delta_n;
+    value_t term1 = delta * delta_n * n1;
+
+    mean_ += delta_n;
+    m4_ += term1 * delta_n2 * (n*n - 3*n + 3) + 6 * delta_n2 * m2_ - 4 * delta_n * m3_;
+    m3_ += term1 * delta_n * (n - 2) - 3 * delta_n * m2_;
+    m2_ += term1;
+}
+
+void MomentAccumulator::update(const vec& data)
+{
+    for(index_t i = 0u; i < data.size(); ++i)
+        update(data[i]);
+}
+
+void MomentAccumulator::merge(const MomentAccumulator& other)
+{
+    if(other.n_ == 0)
+        return;
+
+    if(n_ == 0) {
+        *this = other;
+        return;
+    }
+
+    value_t na = (value_t)n_, nb = (value_t)other.n_;
+    value_t n = na + nb;
+
+    value_t delta = other.mean_ - mean_;
+    value_t delta2 = delta * delta;
+    value_t delta3 = delta2 * delta;
+    value_t delta4 = delta2 * delta2;
+
+    value_t m2 = m2_ + other.m2_ + delta2 * na * nb / n;
+
+    value_t m3 = m3_ + other.m3_
+                 + delta3 * na * nb * (na - nb) / (n*n)
+                 + 3 * delta * (na * other.m2_ - nb * m2_) / n;
+
+    value_t m4 = m4_ + other.m4_
+                 + delta4 * na * nb * (na*na - na*nb + nb*nb) / (n*n*n)
+                 + 6 * delta2 * (na*na * other.m2_ + nb*nb * m2_) / (n*n)
+                 + 4 * delta * (na * other.m3_ - nb * m3_) / n;
+
+    n_ += other.n_;
+    mean_ += delta * nb / n;
+    m2_ = m2;
+    m3_ = m3;
+    m4_ = m4;
+}
+
+value_t MomentAccumulator::var(int norm_type /*= 0*/) const
+{
+    BOOST_ASSERT(norm_type == 0 || norm_type == 1);
+
+    if(n_ < 2)
+        return 0.0;
+
+    return norm_type == 0 ? m2_ / (n_ - 1) : m2_ / n_;
+}
+
+value_t MomentAccumulator::stddev(int norm_type /*= 0*/) const
+{
+    return std::sqrt(var(norm_type));
+}
+
+value_t MomentAccumulator::skewness() const
+{
+    BOOST_ASSERT(n_ > 0);
+    return std::sqrt((value_t)n_) * m3_ / std::pow(m2_, 1.5);
+}
+
+value_t MomentAccumulator::kurtosis() const
+{
+    BOOST_ASSERT(n_ > 0);
+    return (value_t)n_ * m4_ / (m2_ * m2_) - 3.0;
+}
+
+MomentAccumulator accumulate_moments(const vec& source, int n_threads /*= 1*/)
+{
+    BOOST_ASSERT(n_threads >= 1);
+
+    index_t size = source.size();
+    if(n_threads > (int)size)
+        n_threads = size > 0 ? size : 1;
+
+    std::vector<MomentAccumulator> parts(n_threads);
+    const value_t* data = source.memptr();
+
+    auto accumulate_range = [&parts, data](int part, index_t beg, index_t end) {
+        for(index_t i = beg; i < end; ++i)
+            parts[part].update(data[i]);
+    };
+    parallel_parts(size, n_threads, accumulate_range);
+
+    MomentAccumulator res;
+    for(int part = 0; part < n_threads; ++part)
+        res.merge(parts[part]);
+
+    return res;
+}
+
+}
@@ -0,0 +1,200 @@
+#include "smfe/feature/order_statistics.h"
+
+#include <algorithm>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+// Ĳѯһ [data, data+n) 
+namespace
+{
+inline value_t sorted_nth(const value_t* data, index_t n, int nth)
+{
+    BOOST_ASSERT(nth >= 0 && (index_t)nth < n);
+    return data[nth];
+}
+
+inline value_t sorted_median(const value_t* data, index_t n)
+{
+    BOOST_ASSERT(n > 0);
+
+    index_t half = n / 2;
+    if(n % 2 == 0)
+        return (data[half-1] + data[half]) / 2;
+    return data[half];
+}
+
+inline value_t sorted_quantile(const value_t* data, index_t n, value_t p)
+{
+    BOOST_ASSERT(n > 0);
+    BOOST_ASSERT(p >= 0.0 && p <= 1.0);
+
+    value_t pos = p * (n - 1);
+    index_t low = static_cast<index_t>(pos);
+    if(low + 1 >= n)
+        return data[n-1];
+
+    value_t frac = pos - low;
+    return data[low] + (data[low+1] - data[low]) * frac;
+}
+}
+
+OrderStatistics::OrderStatistics(const vec& source)
+    : sorted_(source)
+{
+    BOOST_ASSERT(source.size() > 0);
+    std::sort(sorted_.begin(), sorted_.end());
+}
+
+value_t OrderStatistics::nth(int nth) const
+{
+    return sorted_nth(sorted_.memptr(), size(), nth);
+}
+
+value_t OrderStatistics::min() const
+{
+    return sorted_[0];
+}
+
+value_t OrderStatistics::max() const
+{
+    return sorted_[size()-1];
+}
+
+value_t OrderStatistics::median() const
+{
+    return sorted_median(sorted_.memptr(), size());
+}
+
+value_t OrderStatistics::first_quater() const
+{
+    return nth(size()/4);
+}
+
+value_t OrderStatistics::third_quater() const
+{
+    return nth(size()/4*3);
+}
+
+value_t OrderStatistics::quartile_deviation() const
+{
+    return third_quater() - first_quater();
+}
+
+value_t OrderStatistics::quantile(value_t p) const
+{
+    return sorted_quantile(sorted_.memptr(), size(), p);
+}
+
+value_t OrderStatistics::percentile(value_t percent) const
+{
+    return quantile(percent / 100);
+}
+
+RollingOrderStatistics::RollingOrderStatistics(int window_size)
+    : arrival_(window_size > 0 ? window_size : 0), sorted_(arrival_.size()), head_(0), count_(0)
+{
+    BOOST_ASSERT(window_size > 0);
+}
+
+void RollingOrderStatistics::push(value_t value)
+{
+    const index_t window = arrival_.size();
+    auto sorted_beg = sorted_.begin();
+
+    if(count_ < window) {
+        // û, ֱӲ뵽λ
+        auto pos = std::upper_bound(sorted_beg, sorted_beg + count_, value);
+        std::copy_backward(pos, sorted_beg + count_, sorted_beg + count_ + 1);
+        *pos = value;
+
+        arrival_[(head_ + count_) % window] = value;
+        ++count_;
+        return;
+    }
+
+    //  : Ƴɵ, ¾֮ƶһλ
+    value_t oldest = arrival_[head_];
+    arrival_[head_] = value;
+    head_ = (head_ + 1) % window;
+
+    auto old_pos = std::lower_bound(sorted_beg, sorted_beg + count_, oldest);
+    BOOST_ASSERT(old_pos != sorted_beg + count_ && *old_pos == oldest);
+
+    if(value >= oldest) {
+        auto new_pos = std::upper_bound(old_pos + 1, sorted_beg + count_, value);
+        std::copy(old_pos + 1, new_pos, old_pos);
+        *(new_pos - 1) = value;
+    } else {
+        auto new_pos = std::upper_bound(sorted_beg, old_pos, value);
+        std::copy_backward(new_pos, old_pos, old_pos + 1);
+        *new_pos = value;
+    }
+}
+
+void RollingOrderStatistics::push(const vec& data)
+{
+    for(index_t i = 0u; i < data.size(); ++i)
+        push(data[i]);
+}
+
+void RollingOrderStatistics::clear()
+{
+    head_ = 0;
+    count_ = 0;
+}
+
+vec RollingOrderStatistics::sorted() const
+{
+    return make_vec(sorted_.data(), count_);
+}
+
+value_t RollingOrderStatistics::nth(int nth) const
+{
+    return sorted_nth(sorted_.data(), count_, nth);
+}
+
+value_t RollingOrderStatistics::min() const
+{
+    BOOST_ASSERT(count_ > 0);
+    return sorted_[0];
+}
+
+value_t RollingOrderStatistics::max() const
+{
+    BOOST_ASSERT(count_ > 0);
+    return sorted_[count_-1];
+}
+
+value_t RollingOrderStatistics::median() const
+{
+    return sorted_median(sorted_.data(), count_);
+}
+
+value_t RollingOrderStatistics::first_quater() const
+{
+    return nth(count_/4);
+}
+
+value_t RollingOrderStatistics::third_quater() const
+{
+    return nth(count_/4*3);
+}
+
+value_t RollingOrderStatistics::quartile_deviation() const
+{
+    return third_quater() - first_quater();
+}
+
+value_t RollingOrderStatistics::quantile(value_t p) const
+{
+    return sorted_quantile(sorted_.data(), count_, p);
+}
+
+value_t RollingOrderStatistics::percentile(value_t percent) const
+{
+    return quantile(percent / 100);
+}
+
+}
@@ -0,0 +1,95 @@
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#ifndef PARALLEL_PARTS_H__
+#define PARALLEL_PARTS_H__
+
+#include "smfe/global.h"
+
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+
+/**  [0, n) ֳ n_threads Ĳʱ, partΪ [first, last) @sa parallel_parts */
+inline void part_range(index_t n, int n_threads, int part, index_t& first, index_t& last)
+{
+    first = (index_t)((unsigned long long)n * part / n_threads);
+    last = (index_t)((unsigned long long)n * (part + 1) / n_threads);
+}
+
+namespace detail
+{
+// ʱȴѾ߳, ֤쳣뿪 parallel_parts ֮ǰûпjoin߳
+class ThreadJoiner
+{
+public:
+    explicit ThreadJoiner(std::vector<std::thread>& threads) : threads_(threads) {}
+
+    ~ThreadJoiner()
+    {
+        for(size_t i = 0u; i < threads_.size(); ++i) {
+            if(threads_[i].joinable())
+                threads_[i].join();
+        }
+    }
+
+private:
+    ThreadJoiner(const ThreadJoiner&);
+    ThreadJoiner& operator=(const ThreadJoiner&);
+
+    std::vector<std::thread>& threads_;
+};
+}
+
+/**
+ *  [0, n) ֳ n_threads Ĳֲм
+ *
+ * partΪ [n*part/n_threads, n*(part+1)/n_threads),  fn(part, first, last).
+ * 0ڵǰ߳м, Ĳָʹһ߳, вֶ֮󷵻.
+ * Ҫ֤ n_threads ҪĿ, partĽ԰˳ϲ.
+ *
+ * fn ׳쳣֮߳̽׳(ֶ׳쳣ʱΪpartСһ),
+ * ߳ʧܵʱͬȴѾ֮߳׳.
+ */
+template<typename Fn>
+void parallel_parts(index_t n, int n_threads, Fn fn)
+{
+    BOOST_ASSERT(n_threads >= 1);
+
+    std::vector<std::exception_ptr> errors(n_threads);
+    auto run_part = [n, n_threads, &fn, &errors](int part) {
+        try {
+            index_t first, last;
+            part_range(n, n_threads, part, first, last);
+            fn(part, first, last);
+        }
+        catch(...) {
+            errors[part] = std::current_exception();
+        }
+    };
+
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(n_threads - 1);
+        detail::ThreadJoiner joiner(workers);
+
+        for(int part = 1; part < n_threads; ++part)
+            workers.push_back(std::thread(run_part, part));
+        run_part(0);
+    }
+
+    for(int part = 0; part < n_threads; ++part) {
+        if(errors[part])
+            std::rethrow_exception(errors[part]);
+    }
+}
+
+}
+
+#endif // PARALLEL_PARTS_H__
@@ -0,0 +1,114 @@
+#include "smfe/feature/peak_zero_crossing_detector.h"
+
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+void PeakZeroCrossingDetector::IndexRing::push_back(position_t index)
+{
+    BOOST_ASSERT(size_ < data_.size());
+
+    data_[(head_ + size_) % data_.size()] = index;
+    ++size_;
+}
+
+void PeakZeroCrossingDetector::IndexRing::pop_older_than(position_t index)
+{
+    while(size_ > 0 && data_[head_] < index) {
+        head_ = (head_ + 1) % data_.size();
+        --size_;
+    }
+}
+
+PeakZeroCrossingDetector::PeakZeroCrossingDetector(int window_size)
+    : window_size_(window_size), position_(0), prev_(0.0), prev_prev_(0.0),
+      // й window_size-1 , ¼֮Ƴڵ¼, Ҫһλ
+      peaks_(window_size > 0 ? window_size : 1),
+      zero_crossings_(window_size > 0 ? window_size : 1)
+{
+    BOOST_ASSERT(window_size >= 1);
+}
+
+int PeakZeroCrossingDetector::push(value_t value)
+{
+    int flags = NO_EVENT;
+    const position_t index = position_;
+
+    // һݵ߶Ѿ֪, жǷΪֵ
+    if(index >= 2 && std::fabs(prev_) > std::fabs(prev_prev_) && std::fabs(prev_) > std::fabs(value)) {
+        peaks_.push_back(index - 1);
+        flags |= PEAK;
+    }
+
+    if(index >= 1 && prev_ * value <= 0.0) {
+        zero_crossings_.push_back(index);
+        flags |= ZERO_CROSSING;
+    }
+
+    prev_prev_ = prev_;
+    prev_ = value;
+    ++position_;
+
+    expire();
+
+    return flags;
+}
+
+void PeakZeroCrossingDetector::push(const vec& data, std::vector<Event>& events)
+{
+    for(index_t i = 0u; i < data.size(); ++i) {
+        int flags = push(data[i]);
+
+        if(flags & PEAK) {
+            Event e = { PEAK, position_ - 2 };
+            events.push_back(e);
+        }
+
+        if(flags & ZERO_CROSSING) {
+            Event e = { ZERO_CROSSING, position_ - 1 };
+            events.push_back(e);
+        }
+    }
+}
+
+void PeakZeroCrossingDetector::clear()
+{
+    position_ = 0;
+    prev_ = prev_prev_ = 0.0;
+    peaks_.clear();
+    zero_crossings_.clear();
+}
+
+void PeakZeroCrossingDetector::expire()
+{
+    // Ϊ [position_-window_size_, position_), ӿһ, ڵĵһ
+    // Ƿֵ߹
+    if(position_ < (position_t)window_size_)
+        return;
+
+    position_t first_valid = position_ - window_size_ + 1;
+    peaks_.pop_older_than(first_valid);
+    zero_crossings_.pop_older_than(first_valid);
+}
+
+value_t PeakZeroCrossingDetector::peak_rate(value_t fs /*= 1.0*/) const
+{
+    if(position_ == 0)
+        return 0.0;
+
+    position_t n = position_ < (position_t)window_size_ ? position_ : window_size_;
+    return peak_count() * fs / n;
+}
+
+value_t PeakZeroCrossingDetector::zero_crossing_rate(value_t fs /*= 1.0*/) const
+{
+    if(position_ == 0)
+        return 0.0;
+
+    position_t n = position_ < (position_t)window_size_ ? position_ : window_size_;
+    return zero_crossing_count() * fs / n;
+}
+
+}
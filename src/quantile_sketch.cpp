@@ -0,0 +1,221 @@
+#include "smfe/feature/quantile_sketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+QuantileSketch::QuantileSketch(int k /*= 200*/, unsigned int seed /*= 0*/)
+    : k_(k), n_(0),
+      min_(std::numeric_limits<value_t>::max()),
+      max_(-std::numeric_limits<value_t>::max()),
+      levels_(1), rng_(seed)
+{
+    BOOST_ASSERT(k >= 8);
+    levels_[0].reserve(k);
+    update_capacities();
+}
+
+void QuantileSketch::update_capacities()
+{
+    // Խ͵ĲԽС, ÿһ2/3, СΪ2
+    static const value_t decay = 2.0 / 3.0;
+    const index_t n_levels = levels_.size();
+    capacities_.resize(n_levels);
+    for(index_t level = 0; level < n_levels; ++level) {
+        index_t depth = n_levels - 1 - level;
+        index_t cap = static_cast<index_t>(std::ceil(k_ * std::pow(decay, (value_t)depth)));
+        capacities_[level] = cap < 2 ? 2 : cap;
+    }
+}
+
+index_t QuantileSketch::retained() const
+{
+    index_t res = 0;
+    for(size_t i = 0u; i < levels_.size(); ++i)
+        res += levels_[i].size();
+    return res;
+}
+
+void QuantileSketch::update(value_t value)
+{
+    if(value < min_) min_ = value;
+    if(value > max_) max_ = value;
+    ++n_;
+
+    levels_[0].push_back(value);
+    if(levels_[0].size() >= capacities_[0])
+        compress();
+}
+
+void QuantileSketch::update(const vec& data)
+{
+    for(index_t i = 0u; i < data.size(); ++i)
+        update(data[i]);
+}
+
+void QuantileSketch::compact_level(index_t level)
+{
+    if(level + 1 == levels_.size()) {
+        levels_.push_back(std::vector<value_t>());
+        update_capacities();
+    }
+
+    std::vector<value_t>& cur = levels_[level];
+    std::vector<value_t>& upper = levels_[level+1];
+    std::sort(cur.begin(), cur.end());
+
+    // ݵʱһڵǰ
+    bool has_left = (cur.size() % 2 == 1);
+    value_t left_value = has_left ? cur.back() : 0.0;
+    size_t even_size = cur.size() - (has_left ? 1 : 0);
+
+    // ѡλżλһ, Ȩط
+    size_t offset = rng_() & 1u;
+    for(size_t i = offset; i < even_size; i += 2)
+        upper.push_back(cur[i]);
+
+    cur.clear();
+    if(has_left)
+        cur.push_back(left_value);
+}
+
+void QuantileSketch::compress()
+{
+    for(index_t h = 0; h < levels_.size(); ++h) {
+        if(levels_[h].size() >= capacities_[h])
+            compact_level(h);
+    }
+}
+
+void QuantileSketch::merge(const QuantileSketch& other)
+{
+    BOOST_ASSERT(other.k_ == k_);
+
+    if(other.n_ == 0)
+        return;
+
+    if(levels_.size() < other.levels_.size()) {
+        levels_.resize(other.levels_.size());
+        update_capacities();
+    }
+
+    for(size_t h = 0u; h < other.levels_.size(); ++h)
+        levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+
+    n_ += other.n_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+
+    compress();
+}
+
+std::vector<QuantileSketch::weighted_value_t> QuantileSketch::cumulative_weights() const
+{
+    std::vector<weighted_value_t> items;
+    items.reserve(retained());
+
+    for(size_t h = 0u; h < levels_.size(); ++h) {
+        unsigned long long weight = 1ull << h;
+        for(size_t i = 0u; i < levels_[h].size(); ++i)
+            items.push_back(std::make_pair(levels_[h][i], weight));
+    }
+
+    std::sort(items.begin(), items.end());
+
+    unsigned long long acc = 0;
+    for(size_t i = 0u; i < items.size(); ++i) {
+        acc += items[i].second;
+        items[i].second = acc;
+    }
+
+    return items;
+}
+
+namespace
+{
+typedef std::pair<value_t, unsigned long long> weighted_value_t;
+
+inline value_t nth_of_cumulative(const std::vector<weighted_value_t>& items, unsigned long long nth)
+{
+    // ҵһۼȨشnth
+    auto ite = std::upper_bound(items.begin(), items.end(), nth,
+        [](unsigned long long rank, const weighted_value_t& item) {
+            return rank < item.second;
+        });
+
+    if(ite == items.end())
+        return items.back().first;
+    return ite->first;
+}
+
+inline value_t nth_of_sketch(const std::vector<weighted_value_t>& items, unsigned long long nth,
+                             unsigned long long n, value_t min_v, value_t max_v)
+{
+    if(nth == 0)
+        return min_v;
+    if(nth == n - 1)
+        return max_v;
+    return nth_of_cumulative(items, nth);
+}
+
+//  OrderStatistics::quantile һ, λ p*(n-1) ߵ˳ͳ֮Բֵ
+inline value_t quantile_of_sketch(const std::vector<weighted_value_t>& items, value_t p,
+                                  unsigned long long n, value_t min_v, value_t max_v)
+{
+    BOOST_ASSERT(p >= 0.0 && p <= 1.0);
+
+    value_t pos = p * (n - 1);
+    unsigned long long low = static_cast<unsigned long long>(pos);
+    value_t low_value = nth_of_sketch(items, low, n, min_v, max_v);
+    if(low + 1 >= n)
+        return low_value;
+
+    value_t frac = pos - low;
+    if(frac == 0.0)
+        return low_value;
+    return low_value + (nth_of_sketch(items, low + 1, n, min_v, max_v) - low_value) * frac;
+}
+}
+
+value_t QuantileSketch::nth(unsigned long long nth) const
+{
+    BOOST_ASSERT(n_ > 0 && nth < n_);
+
+    if(nth == 0)
+        return min_;
+    if(nth == n_ - 1)
+        return max_;
+
+    return nth_of_cumulative(cumulative_weights(), nth);
+}
+
+value_t QuantileSketch::quantile(value_t p) const
+{
+    BOOST_ASSERT(n_ > 0);
+    return quantile_of_sketch(cumulative_weights(), p, n_, min_, max_);
+}
+
+vec QuantileSketch::quantiles(const vec& ps) const
+{
+    BOOST_ASSERT(n_ > 0);
+
+    auto items = cumulative_weights();
+
+    vec res(ps.size());
+    for(index_t i = 0u; i < ps.size(); ++i)
+        res[i] = quantile_of_sketch(items, ps[i], n_, min_, max_);
+
+    return res;
+}
+
+value_t QuantileSketch::normalized_rank_error() const
+{
+    // ֵ Apache DataSketches KLL sketchλѯľ
+    return 2.296 / std::pow((value_t)k_, 0.9723);
+}
+
+}
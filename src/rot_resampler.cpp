@@ -0,0 +1,141 @@
+#include "smfe/feature/rot_resampler.h"
+
+#include <cmath>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+namespace
+{
+// q0q1ֵ֮, fΪq1Ȩ
+inline void interpolate(const value_t* q0, const value_t* q1, value_t f, RotInterpolation method,
+                        value_t* out)
+{
+    value_t d = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+
+    // תͬһ, Ž϶̵Ļֵ
+    value_t sign = 1.0;
+    if(d < 0) {
+        sign = -1.0;
+        d = -d;
+    }
+
+    value_t w0 = 1 - f, w1 = f;
+    // нǺСʱ sin ӽ0, ֱʹԲֵ
+    if(method == SLERP_INTERPOLATION && d < 0.9995) {
+        value_t theta = std::acos(d);
+        value_t inv_sin = 1 / std::sin(theta);
+        w0 = std::sin((1 - f) * theta) * inv_sin;
+        w1 = std::sin(f * theta) * inv_sin;
+    }
+    w1 *= sign;
+
+    value_t r[4];
+    for(int c = 0; c < 4; ++c)
+        r[c] = w0 * q0[c] + w1 * q1[c];
+
+    const value_t inv_norm = 1 / std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3]);
+    for(int c = 0; c < 4; ++c)
+        out[c] = r[c] * inv_norm;
+}
+}
+
+mat resample_rot_mat(const mat& rot_mat, const vec& rot_times, const vec& target_times,
+                     RotInterpolation method /*= SLERP_INTERPOLATION*/)
+{
+    BOOST_ASSERT(rot_mat.n_rows == 4 && rot_mat.n_cols > 0);
+    BOOST_ASSERT(rot_times.size() == rot_mat.n_cols);
+
+    const index_t m = rot_mat.n_cols;
+    const index_t n = target_times.size();
+
+    // 鲢, õÿһĿڵͲֵϵ
+    std::vector<index_t> lo(n);
+    std::vector<value_t> frac(n);
+    index_t j = 0;
+    for(index_t i = 0u; i < n; ++i) {
+        const value_t t = target_times[i];
+        BOOST_ASSERT(i == 0 || t >= target_times[i - 1]);
+
+        while(j + 1 < m && rot_times[j + 1] <= t)
+            ++j;
+
+        lo[i] = j;
+        if(j + 1 < m && t > rot_times[j])
+            frac[i] = (t - rot_times[j]) / (rot_times[j + 1] - rot_times[j]);
+        else
+            frac[i] = 0.0;
+    }
+
+    mat res(4, n);
+    for(index_t i = 0u; i < n; ++i) {
+        const index_t hi = (lo[i] + 1 < m) ? lo[i] + 1 : lo[i];
+        interpolate(rot_mat.colptr(lo[i]), rot_mat.colptr(hi), frac[i], method, res.colptr(i));
+    }
+
+    return res;
+}
+
+RotResampler::RotResampler(RotInterpolation method /*= SLERP_INTERPOLATION*/)
+    : method_(method)
+{
+}
+
+void RotResampler::push(value_t time, const vec& rot)
+{
+    BOOST_ASSERT(rot.size() == 4);
+    BOOST_ASSERT(samples_.empty() || time > samples_.back().time);
+
+    Sample s;
+    s.time = time;
+    for(int c = 0; c < 4; ++c)
+        s.rot[c] = rot[c];
+    samples_.push_back(s);
+}
+
+void RotResampler::push(const mat& rot_mat, const vec& times)
+{
+    BOOST_ASSERT(rot_mat.n_rows == 4 && times.size() == rot_mat.n_cols);
+
+    for(index_t i = 0u; i < rot_mat.n_cols; ++i) {
+        BOOST_ASSERT(samples_.empty() || times[i] > samples_.back().time);
+
+        Sample s;
+        s.time = times[i];
+        for(int c = 0; c < 4; ++c)
+            s.rot[c] = rot_mat(c, i);
+        samples_.push_back(s);
+    }
+}
+
+index_t RotResampler::resample(const vec& target_times, mat& out)
+{
+    index_t n = 0;
+    if(!samples_.empty()) {
+        const value_t last_time = samples_.back().time;
+        while(n < target_times.size() && target_times[n] <= last_time)
+            ++n;
+    }
+
+    out.set_size(4, n);
+    for(index_t i = 0u; i < n; ++i) {
+        const value_t t = target_times[i];
+
+        // Ŀʱ䲻ݼ, ֮ǰԪõ
+        while(samples_.size() > 1 && samples_[1].time <= t)
+            samples_.pop_front();
+
+        //  resample_rot_mat ʹͬϵ, ڵһԪ֮ǰҲֵ(һ),
+        // ֤ߵĽȫһ
+        const Sample& s0 = samples_[0];
+        const Sample& s1 = samples_.size() > 1 ? samples_[1] : s0;
+        const value_t f = (samples_.size() > 1 && t > s0.time) ? (t - s0.time) / (s1.time - s0.time) : 0.0;
+        interpolate(s0.rot, s1.rot, f, method_, out.colptr(i));
+    }
+
+    return n;
+}
+
+}
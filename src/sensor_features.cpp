@@ -4,17 +4,21 @@
 #include "smfe/feature/statistic_features.h"
 #include <boost/assert.hpp>
 
+#include <cmath>
+
+#include "kernel/signal_kernels.h"
+
 namespace smfe
 {
 inline bool is_noise(value_t value, value_t noise_value)
 {
-    return abs(value) < noise_value;
+    return std::abs(value) < noise_value;
 }
 
 inline bool is_zero(value_t value)
 {
     static const value_t error = 1e-7;
-    return abs(value) < error;
+    return std::abs(value) < error;
 }
 
 inline value_t last_elem(const vec& d)
@@ -58,6 +62,11 @@ vec velocity_impl(const vec& acce_data,
     vec res_velocity(two_value_filtered_data.size());
     res_velocity[0] = init_velocity;
 
+    // ÿһ,  ((a0 + a1) / 2) * delta Ľȫͬ
+    vec area(res_velocity.size() - 1);
+    kernel::signal_kernels().newton_cotes_areas(two_value_filtered_data.memptr(), area.size(), 2, delta,
+                                                area.memptr());
+
     for(int i = 1; i < res_velocity.size(); ++i) {
         if(is_zero(two_value_filtered_data[i]))
             ++station_count;
@@ -68,7 +77,7 @@ vec velocity_impl(const vec& acce_data,
         if(station_count > station_count_threshold)
             res_velocity[i] = 0.0;
         else
-            res_velocity[i] = ((two_value_filtered_data[i-1]+two_value_filtered_data[i])/2)*delta + res_velocity[i-1];
+            res_velocity[i] = area[i-1] + res_velocity[i-1];
     }
 
     return res_velocity;
@@ -196,11 +205,23 @@ vec rotate_amg_vec(const vec& rot, const vec& amg_v)
 mat rotate_amg_mat(const mat& rot_mat, const mat& amg_mat)
 {
 	BOOST_ASSERT(amg_mat.n_rows == 9 && rot_mat.n_rows == 4 && rot_mat.n_cols == amg_mat.n_cols);
-	mat res = arma::zeros<mat>(amg_mat.n_rows, amg_mat.n_cols);
+	mat res(amg_mat.n_rows, amg_mat.n_cols);
 
-	for(int i = 0; i < amg_mat.n_cols; ++i) {
-		res.col(i) = rotate_amg_vec(rot_mat.col(i), amg_mat.col(i));
-	}
+	// ֱת, Ҫÿһ֡ʱvec
+	kernel::signal_kernels().rotate_amg(rot_mat.memptr(), amg_mat.memptr(), amg_mat.n_cols, AmgMask,
+	                                    nullptr, res.memptr());
+
+	return res;
+}
+
+mat rotate_amg_channels(const mat& rot_mat, const mat& amg_mat, int channels)
+{
+	BOOST_ASSERT(amg_mat.n_rows == 9 && rot_mat.n_rows == 4 && rot_mat.n_cols == amg_mat.n_cols);
+	BOOST_ASSERT(channel_count(channels) > 0);
+
+	mat res(3 * channel_count(channels), amg_mat.n_cols);
+	kernel::signal_kernels().rotate_amg(rot_mat.memptr(), amg_mat.memptr(), amg_mat.n_cols, channels,
+	                                    nullptr, res.memptr());
 
 	return res;
 }
@@ -212,8 +233,8 @@ vec moving_distance_of_amg_mat(const vec& rot, const mat& amg_mat,
                                int station_count_threshold /*= INT_MAX*/, 
                                bool using_ave_filter /*= false*/, int filter_size /*= 2*/, int degree /*= 3 */)
 {
-	// õתȫϵµļٶmat, ÿһбʾһ
-	auto rotated_acce_mat = unpack_amg_mat(rotate_amg_mat(rot, amg_mat), 0);
+	// ֻתٶ, õȫϵµļٶmat, ÿһбʾһ
+	auto rotated_acce_mat = rotate_amg_channels(rot, amg_mat, AcceMask);
 	BOOST_ASSERT(rotated_acce_mat.n_rows == 3);
 
 	vec res(3);
@@ -227,8 +248,8 @@ vec moving_distance_of_amg_mat(const vec& rot, const mat& amg_mat,
 
 vec last_velocity_of_amg_mat(const vec& rot, const mat& amg_mat, vec delta /*= make_3dvec(1.0, 1.0, 1.0)*/, vec init_velocity /*= make_3dvec(0.0, 0.0, 0.0)*/, vec still_acce_threshold /*= make_3dvec(0.0, 0.0, 0.0)*/, int station_count_threshold /*= INT_MAX*/, bool using_ave_filter /*= false*/, int filter_size /*= 2 */)
 {
-    // õתȫϵµļٶmat, ÿһбʾһ
-    auto rotated_acce_mat = unpack_amg_mat(rotate_amg_mat(rot, amg_mat), 0);
+    // ֻתٶ, õȫϵµļٶmat, ÿһбʾһ
+    auto rotated_acce_mat = rotate_amg_channels(rot, amg_mat, AcceMask);
     BOOST_ASSERT(rotated_acce_mat.n_rows == 3);
 
     vec res(3);
@@ -242,8 +263,8 @@ vec last_velocity_of_amg_mat(const vec& rot, const mat& amg_mat, vec delta /*= m
 
 vec rotated_angle_of_amg_mat(const vec& rot, const mat& amg_mat, vec delta /*= make_3dvec(1.0, 1.0, 1.0)*/, bool using_ave_filter /*= false*/, int filter_size /*= 2*/, int degree /*= 3 */)
 {
-    // õתȫϵmat, ÿһбʾһ
-    auto rotated_gyro_mat = unpack_amg_mat(rotate_amg_mat(rot, amg_mat), 2);
+    // ֻת, õȫϵmat, ÿһбʾһ
+    auto rotated_gyro_mat = rotate_amg_channels(rot, amg_mat, GyroMask);
     BOOST_ASSERT(rotated_gyro_mat.n_rows == 3);
 
 	vec res(3);
@@ -0,0 +1,162 @@
+#include "smfe/feature/sliding_dft.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+namespace
+{
+const value_t PI = 3.14159265358979323846;
+}
+
+SlidingDft::SlidingDft(int window_size, value_t fs)
+    : fs_(fs), buffer_(window_size > 0 ? window_size : 1, 0.0), head_(0), count_(0)
+{
+    BOOST_ASSERT(window_size > 0);
+
+    roots_.resize(buffer_.size());
+    for(size_t n = 0u; n < roots_.size(); ++n)
+        roots_[n] = std::polar(1.0, -2.0 * PI * n / roots_.size());
+}
+
+int SlidingDft::add_bin(int k)
+{
+    const int n = buffer_.size();
+    BOOST_ASSERT(k >= 0 && k <= n / 2);
+
+    for(size_t i = 0u; i < bins_.size(); ++i) {
+        if(bins_[i].k == k)
+            return i;
+    }
+
+    Bin bin;
+    bin.k = k;
+    bin.twiddle = std::conj(roots_[k]);
+    bin.value = dft_of_window(k);
+    bins_.push_back(bin);
+
+    return bins_.size() - 1;
+}
+
+int SlidingDft::add_band(value_t low_fre, value_t high_fre)
+{
+    BOOST_ASSERT(low_fre <= high_fre);
+
+    const int n = buffer_.size();
+    const value_t resolution = fs_ / n;
+
+    int first = (int)std::ceil(low_fre / resolution - 1e-9);
+    int last = (int)std::floor(high_fre / resolution + 1e-9);
+    if(first < 0) first = 0;
+    if(last > n / 2) last = n / 2;
+
+    std::vector<int> band;
+    for(int k = first; k <= last; ++k)
+        band.push_back(add_bin(k));
+
+    bands_.push_back(band);
+    return bands_.size() - 1;
+}
+
+complex_t SlidingDft::dft_of_window(int k) const
+{
+    // ɵݶӦ n = 0
+    const index_t n = buffer_.size();
+    complex_t sum(0.0, 0.0);
+    for(index_t i = 0u; i < n; ++i)
+        sum += buffer_[(head_ + i) % n] * roots_[((unsigned long long)k * i) % n];
+    return sum;
+}
+
+void SlidingDft::resync()
+{
+    for(size_t i = 0u; i < bins_.size(); ++i)
+        bins_[i].value = dft_of_window(bins_[i].k);
+}
+
+void SlidingDft::push(value_t value)
+{
+    value_t delta = value - buffer_[head_];
+    buffer_[head_] = value;
+    head_ = (head_ + 1) % buffer_.size();
+    ++count_;
+
+    // ÿһ¼һ, Ƶۼ
+    if(head_ == 0) {
+        resync();
+        return;
+    }
+
+    for(size_t i = 0u; i < bins_.size(); ++i)
+        bins_[i].value = (bins_[i].value + delta) * bins_[i].twiddle;
+}
+
+void SlidingDft::push(const vec& data)
+{
+    for(index_t i = 0u; i < data.size(); ++i)
+        push(data[i]);
+}
+
+void SlidingDft::clear()
+{
+    std::fill(buffer_.begin(), buffer_.end(), 0.0);
+    head_ = 0;
+    count_ = 0;
+
+    for(size_t i = 0u; i < bins_.size(); ++i)
+        bins_[i].value = complex_t(0.0, 0.0);
+}
+
+FrequencyMagnitude SlidingDft::bin(int i) const
+{
+    BOOST_ASSERT(i >= 0 && i < (int)bins_.size());
+
+    const int n = buffer_.size();
+    const Bin& b = bins_[i];
+
+    //  frequency_magnitude_vec һ, ֱ2
+    value_t mag = std::abs(b.value) / n;
+    if(b.k != 0)
+        mag *= 2;
+
+    return FrequencyMagnitude((value_t)(b.k) * fs_ / n, mag);
+}
+
+fm_vec SlidingDft::bins() const
+{
+    fm_vec res(bins_.size());
+    for(size_t i = 0u; i < bins_.size(); ++i)
+        res[i] = bin(i);
+    return res;
+}
+
+value_t SlidingDft::band_energy(int band) const
+{
+    BOOST_ASSERT(band >= 0 && band < (int)bands_.size());
+
+    value_t sum = 0.0;
+    const std::vector<int>& members = bands_[band];
+    for(size_t i = 0u; i < members.size(); ++i) {
+        value_t mag = bin(members[i]).mag;
+        sum += mag * mag;
+    }
+    return sum;
+}
+
+FrequencyMagnitude SlidingDft::dominant() const
+{
+    BOOST_ASSERT(!bins_.empty());
+
+    FrequencyMagnitude res = bin(0);
+    for(size_t i = 1u; i < bins_.size(); ++i) {
+        FrequencyMagnitude fm = bin(i);
+        if(fm.mag > res.mag)
+            res = fm;
+    }
+    return res;
+}
+
+}
@@ -0,0 +1,141 @@
+#include "smfe/feature/stft.h"
+
+#include <cstring>
+
+#include <boost/assert.hpp>
+
+#include "fft/real_fft.h"
+#include "kernel/signal_kernels.h"
+
+namespace smfe
+{
+Stft::Stft(int frame_size, int hop_size, value_t fs, WindowType window /*= HANN_WINDOW*/,
+           int entropy_nbins /*= 10*/)
+    : frame_size_(frame_size), hop_size_(hop_size), scale_(0.0),
+      entropy_(entropy_nbins), buffered_(0), skip_(0)
+{
+    BOOST_ASSERT(frame_size > 0);
+    BOOST_ASSERT(hop_size > 0);
+
+    window_ = make_window(window, frame_size);
+    scale_ = 2.0 / arma::accu(window_);
+
+    frequencies_.set_size(n_bins());
+    for(int i = 0; i < n_bins(); ++i)
+        frequencies_[i] = (value_t)(i) * fs / frame_size;
+
+    plan_ = fft::RealFftPlan::get(frame_size);
+    in_.reset(new fft::AlignedBuffer<value_t>(frame_size));
+    out_.reset(new fft::AlignedBuffer<complex_t>(n_bins()));
+
+    buffer_.set_size(frame_size);
+}
+
+Stft::~Stft()
+{
+}
+
+void Stft::prepare(index_t n_frames)
+{
+    magnitude_.set_size(n_bins(), n_frames);
+    features_.principal_frequency.set_size(n_frames);
+    features_.energy.set_size(n_frames);
+    features_.entropy.set_size(n_frames);
+    features_.centroid.set_size(n_frames);
+}
+
+void Stft::process_frame(const value_t* data, index_t column)
+{
+    value_t* in = in_->data();
+    for(int i = 0; i < frame_size_; ++i)
+        in[i] = data[i] * window_[i];
+
+    plan_->execute(in, out_->data());
+
+    //  frequency_magnitude_vec һ, ֱҪ2
+    value_t* mag = magnitude_.colptr(column);
+    kernel::signal_kernels().magnitude(reinterpret_cast<const value_t*>(out_->data()),
+                                       n_bins(), scale_, mag);
+    mag[0] /= 2;
+
+    int max_index = 0;
+    value_t energy = 0.0, weighted_sum = 0.0, mag_sum = 0.0;
+    for(int i = 0; i < n_bins(); ++i) {
+        if(mag[i] > mag[max_index])
+            max_index = i;
+        energy += mag[i] * mag[i];
+        weighted_sum += frequencies_[i] * mag[i];
+        mag_sum += mag[i];
+    }
+
+    features_.principal_frequency[column] = frequencies_[max_index];
+    features_.energy[column] = energy;
+    features_.entropy[column] = entropy_(mag, n_bins());
+    features_.centroid[column] = mag_sum > 0.0 ? weighted_sum / mag_sum : 0.0;
+}
+
+index_t Stft::compute(const vec& source)
+{
+    index_t n_frames = source.size() >= (index_t)frame_size_ ?
+                       (source.size() - frame_size_) / hop_size_ + 1 : 0;
+
+    prepare(n_frames);
+    for(index_t i = 0u; i < n_frames; ++i)
+        process_frame(source.memptr() + i * hop_size_, i);
+
+    return n_frames;
+}
+
+index_t Stft::push(const vec& samples)
+{
+    // ȼ㱾εÿɵ֡, һηýĿռ
+    index_t m = samples.size();
+    index_t skipped = skip_ < m ? skip_ : m;
+    index_t total = buffered_ + (m - skipped);
+    index_t n_frames = total >= (index_t)frame_size_ ? (total - frame_size_) / hop_size_ + 1 : 0;
+
+    prepare(n_frames);
+
+    index_t column = 0, i = 0;
+    while(i < m) {
+        if(skip_ > 0) {
+            index_t d = skip_ < m - i ? skip_ : m - i;
+            skip_ -= d;
+            i += d;
+            continue;
+        }
+
+        index_t d = frame_size_ - buffered_;
+        if(d > m - i)
+            d = m - i;
+        std::memcpy(buffer_.memptr() + buffered_, samples.memptr() + i, d * sizeof(value_t));
+        buffered_ += d;
+        i += d;
+
+        if(buffered_ == (index_t)frame_size_) {
+            process_frame(buffer_.memptr(), column++);
+
+            // ֻһ֡صĲ
+            if(hop_size_ < frame_size_) {
+                std::memmove(buffer_.memptr(), buffer_.memptr() + hop_size_,
+                             (frame_size_ - hop_size_) * sizeof(value_t));
+                buffered_ = frame_size_ - hop_size_;
+            } else {
+                buffered_ = 0;
+                skip_ = hop_size_ - frame_size_;
+            }
+        }
+    }
+
+    BOOST_ASSERT(column == n_frames);
+    return n_frames;
+}
+
+void Stft::clear()
+{
+    buffered_ = 0;
+    skip_ = 0;
+    prepare(0);
+}
+
+}
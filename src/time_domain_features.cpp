@@ -1,11 +1,9 @@
 #include "smfe/feature/time_domain_features.h"
 #include "smfe/feature/statistic_features.h"
 #include "smfe/feature/integral_calculus.h"
+#include "smfe/feature/moment_accumulator.h"
+#include "kernel/reduce_kernels.h"
 
-#include <boost/accumulators/framework/accumulator_set.hpp>
-#include <boost/accumulators/statistics/stats.hpp>
-#include <boost/accumulators/statistics/skewness.hpp>
-#include <boost/accumulators/statistics/kurtosis.hpp>
 #include <boost/type_traits/is_same.hpp>
 
 #include <functional>
@@ -16,31 +14,36 @@ namespace smfe
 
 value_t skewness(const vec& source)
 {
-    using namespace boost::accumulators;
-
     CHECK_VALUE_TYPE(source);
 
-    accumulator_set<value_t, stats<tag::skewness > > ske_set;
-    std::for_each(source.begin(), source.end(), std::ref(ske_set));
-
-    return boost::accumulators::skewness(ske_set);
+    MomentAccumulator acc;
+    acc.update(source);
+    return acc.skewness();
 }
 
 value_t kurtosis(const vec& source)
 {
-    using namespace boost::accumulators;
-
     CHECK_VALUE_TYPE(source);
 
-    accumulator_set<value_t, stats<tag::kurtosis > > kur_set;
-    std::for_each(source.begin(), source.end(), std::ref(kur_set));
-
-    return boost::accumulators::kurtosis(kur_set);
+    MomentAccumulator acc;
+    acc.update(source);
+    return acc.kurtosis();
 }
 
 value_t quartile_deviation(const vec& source)
 {
-    return third_quater(source) - first_quater(source);
+    BOOST_ASSERT(source.size() > 0);
+
+    // copy source once, select the third quater first, then the first quater
+    // only needs to be searched in the lower part
+    vec res = source;
+    auto third_ite = res.begin() + res.size()/4*3;
+    std::nth_element(res.begin(), third_ite, res.end());
+
+    auto first_ite = res.begin() + res.size()/4;
+    std::nth_element(res.begin(), first_ite, third_ite);
+
+    return *third_ite - *first_ite;
 }
 
 value_t cross_correlation_coefficient(const vec& lhs, const vec& rhs)
@@ -52,18 +55,19 @@ value_t cross_correlation_coefficient(const vec& lhs, const vec& rhs)
 
 value_t mean_absolute_deviation(const vec& source)
 {
-    value_t m = smfe::mean(source);
+    BOOST_ASSERT(source.size() > 0);
 
-    value_t sum = 0.0;
-    for(auto ite = source.begin(); ite != source.end(); ++ite)
-        sum += abs(*ite - m);
+    const kernel::ReduceKernels& k = kernel::reduce_kernels();
+    value_t m = k.sum(source.memptr(), source.size()) / source.size();
 
-    return sum / source.size();
+    return k.sum_abs_dev(source.memptr(), source.size(), m) / source.size();
 }
 
 value_t mean_absolute_value(const vec& source)
 {
-    return smfe::mean(make_abs(source));
+    BOOST_ASSERT(source.size() > 0);
+
+    return kernel::reduce_kernels().sum_abs(source.memptr(), source.size()) / source.size();
 }
 
 index_vec peak_index(const vec& source)
@@ -168,7 +172,10 @@ value_t three_axis_amplitude(const vec& c)
 
 value_t sma(const vec& c)
 {
-    return integration(make_abs(c));
+    CHECK_VALUE_TYPE(c);
+
+    // ȼ integration(make_abs(c)), Ҫ
+    return kernel::newton_cotes_sum(c.memptr(), c.size(), 2, true);
 }
 
 vec three_axis_amplitude(const mat& m)
@@ -0,0 +1,105 @@
+#include "smfe/feature/welch_psd.h"
+
+#include <cmath>
+#include <vector>
+
+#include <boost/assert.hpp>
+
+#include "fft/real_fft.h"
+#include "parallel_parts.h"
+
+namespace smfe
+{
+WelchPsd::WelchPsd(int segment_size, int overlap, value_t fs, WindowType window /*= HANN_WINDOW*/)
+    : segment_size_(segment_size), step_(segment_size - overlap), fs_(fs), n_segments_(0)
+{
+    BOOST_ASSERT(segment_size > 0);
+    BOOST_ASSERT(overlap >= 0 && overlap < segment_size);
+
+    window_ = make_window(window, segment_size);
+    window_sum_ = arma::accu(window_);
+    window_sq_sum_ = arma::dot(window_, window_);
+
+    const int n_bins = segment_size / 2 + 1;
+    frequencies_.set_size(n_bins);
+    for(int i = 0; i < n_bins; ++i)
+        frequencies_[i] = (value_t)(i) * fs / segment_size;
+
+    plan_ = fft::RealFftPlan::get(segment_size);
+}
+
+WelchPsd::~WelchPsd()
+{
+}
+
+void WelchPsd::accumulate(const vec& source, index_t first, index_t last, vec& power) const
+{
+    const int n_bins = plan_->n_bins();
+    fft::AlignedBuffer<value_t> in(segment_size_);
+    fft::AlignedBuffer<complex_t> out(n_bins);
+
+    power.zeros(n_bins);
+    for(index_t s = first; s < last; ++s) {
+        const value_t* data = source.memptr() + s * step_;
+        for(int i = 0; i < segment_size_; ++i)
+            in[i] = data[i] * window_[i];
+
+        plan_->execute(in.data(), out.data());
+
+        for(int i = 0; i < n_bins; ++i)
+            power[i] += std::norm(out[i]);
+    }
+}
+
+const vec& WelchPsd::compute(const vec& source, int n_threads /*= 1*/)
+{
+    BOOST_ASSERT(source.size() >= (index_t)segment_size_);
+    BOOST_ASSERT(n_threads >= 1);
+
+    n_segments_ = (source.size() - segment_size_) / step_ + 1;
+    if(n_threads > (int)n_segments_)
+        n_threads = n_segments_;
+
+    // ÿһ̼߳һ, ̵߳˳
+    std::vector<vec> parts(n_threads);
+    auto accumulate_part = [this, &source, &parts](int part, index_t first, index_t last) {
+        accumulate(source, first, last, parts[part]);
+    };
+    parallel_parts(n_segments_, n_threads, accumulate_part);
+
+    power_ = parts[0];
+    for(int part = 1; part < n_threads; ++part)
+        power_ += parts[part];
+    power_ /= n_segments_;
+
+    // , ֱżʱο˹Ƶ, ƵʵĹҪ2
+    const index_t n_bins = power_.size();
+    psd_ = power_ * (2.0 / (fs_ * window_sq_sum_));
+    psd_[0] /= 2;
+    if(segment_size_ % 2 == 0)
+        psd_[n_bins - 1] /= 2;
+
+    return psd_;
+}
+
+fm_vec WelchPsd::frequency_magnitude_vec() const
+{
+    fm_vec res(power_.size());
+    for(index_t i = 0u; i < power_.size(); ++i) {
+        //  frequency_magnitude_vec һ, ֱҪ2
+        value_t scale = (i == 0 ? 1.0 : 2.0) / window_sum_;
+        res[i].fre = frequencies_[i];
+        res[i].mag = scale * std::sqrt(power_[i]);
+    }
+    return res;
+}
+
+fm_vec welch_frequency_magnitude_vec(const vec& source, value_t fs, int segment_size, int overlap,
+                                     WindowType window /*= HANN_WINDOW*/, int n_threads /*= 1*/)
+{
+    WelchPsd welch(segment_size, overlap, fs, window);
+    welch.compute(source, n_threads);
+    return welch.frequency_magnitude_vec();
+}
+
+}
@@ -0,0 +1,74 @@
+#include "smfe/feature/window_function.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+namespace
+{
+const value_t PI = 3.14159265358979323846;
+}
+
+vec make_window(WindowType type, int size)
+{
+    BOOST_ASSERT(size > 0);
+
+    vec res(size);
+    res.fill(1.0);
+
+    // Ϊ1Ĵûа취һ, ȫʹ1
+    if(size == 1 || type == RECTANGULAR_WINDOW)
+        return res;
+
+    const value_t m = size - 1.0;
+
+    for(int n = 0; n < size; ++n) {
+        value_t x = 2.0 * PI * n / m;
+
+        switch(type) {
+        case HANN_WINDOW:
+            res[n] = 0.5 * (1.0 - std::cos(x));
+            break;
+        case HAMMING_WINDOW:
+            res[n] = 0.53836 - 0.46164 * std::cos(x);
+            break;
+        case BLACKMAN_WINDOW:
+            res[n] = 0.42 - 0.5 * std::cos(x) + 0.08 * std::cos(2.0 * x);
+            break;
+        case BARLETT_WINDOW:
+            res[n] = 1.0 - (2.0 * std::fabs(n - m / 2.0)) / m;
+            break;
+        case FLATTOP_WINDOW:
+            res[n] = 1.0 - 1.93 * std::cos(x) + 1.29 * std::cos(2.0 * x)
+                     - 0.388 * std::cos(3.0 * x) + 0.032 * std::cos(4.0 * x);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return res;
+}
+
+WindowType window_type_from_string(const std::string& str)
+{
+    if(str == "Rectangular")
+        return RECTANGULAR_WINDOW;
+    if(str == "Hann")
+        return HANN_WINDOW;
+    if(str == "Hamming")
+        return HAMMING_WINDOW;
+    if(str == "Blackman")
+        return BLACKMAN_WINDOW;
+    if(str == "Barlett")
+        return BARLETT_WINDOW;
+    if(str == "Flattop")
+        return FLATTOP_WINDOW;
+
+    throw std::invalid_argument(str + " is not a valid window type");
+}
+
+}
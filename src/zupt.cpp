@@ -0,0 +1,155 @@
+#include "smfe/feature/zupt.h"
+
+#include <cmath>
+
+#include <boost/assert.hpp>
+
+namespace smfe
+{
+StationaryDetector::StationaryDetector(value_t gravity,
+                                       value_t acce_threshold,
+                                       value_t acce_variance_threshold,
+                                       value_t gyro_threshold,
+                                       int half_window /*= 2*/,
+                                       int min_frames /*= 5*/)
+    : gravity_(gravity), acce_threshold_(acce_threshold),
+      acce_variance_threshold_(acce_variance_threshold), gyro_threshold_(gyro_threshold),
+      half_window_(half_window), min_frames_(min_frames)
+{
+    BOOST_ASSERT(acce_threshold >= 0 && acce_variance_threshold >= 0 && gyro_threshold >= 0);
+    BOOST_ASSERT(half_window >= 0);
+    BOOST_ASSERT(min_frames > 0);
+}
+
+index_pair_vec StationaryDetector::detect(const mat& acce, const mat& gyro) const
+{
+    BOOST_ASSERT(acce.n_rows == 3 && gyro.n_rows == 3 && acce.n_cols == gyro.n_cols);
+
+    const int n = acce.n_cols;
+
+    // ٶģǰ׺, O(1)ÿһڵķ
+    vec acce_norm(n);
+    vec prefix(n + 1), prefix_sq(n + 1);
+    prefix[0] = prefix_sq[0] = 0.0;
+    for(int i = 0; i < n; ++i) {
+        const value_t* a = acce.colptr(i);
+        acce_norm[i] = std::sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+        prefix[i + 1] = prefix[i] + acce_norm[i];
+        prefix_sq[i + 1] = prefix_sq[i] + acce_norm[i] * acce_norm[i];
+    }
+
+    index_pair_vec res;
+    int run_start = -1;
+    for(int i = 0; i <= n; ++i) {
+        bool still = false;
+        if(i < n) {
+            const int lo = std::max(0, i - half_window_);
+            const int hi = std::min(n - 1, i + half_window_);
+            const value_t count = hi - lo + 1;
+            const value_t mean = (prefix[hi + 1] - prefix[lo]) / count;
+            const value_t variance = (prefix_sq[hi + 1] - prefix_sq[lo]) / count - mean * mean;
+
+            const value_t* g = gyro.colptr(i);
+            const value_t gyro_norm = std::sqrt(g[0]*g[0] + g[1]*g[1] + g[2]*g[2]);
+
+            still = std::abs(acce_norm[i] - gravity_) < acce_threshold_
+                    && variance < acce_variance_threshold_
+                    && gyro_norm < gyro_threshold_;
+        }
+
+        if(still) {
+            if(run_start < 0)
+                run_start = i;
+        } else if(run_start >= 0) {
+            if(i - run_start >= min_frames_)
+                res.push_back(std::make_pair((index_t)run_start, (index_t)(i - 1)));
+            run_start = -1;
+        }
+    }
+
+    return res;
+}
+
+index_pair_vec StationaryDetector::detect(const mat& amg_mat) const
+{
+    BOOST_ASSERT(amg_mat.n_rows == 9);
+
+    return detect(amg_mat.rows(0, 2), amg_mat.rows(6, 8));
+}
+
+mat zupt_velocity(const mat& acce, value_t delta, const index_pair_vec& stationary,
+                  const vec& init_velocity /*= vec()*/)
+{
+    BOOST_ASSERT(acce.n_rows == 3);
+    BOOST_ASSERT(init_velocity.empty() || init_velocity.size() == 3);
+
+    const index_t n = acce.n_cols;
+    mat res(3, n);
+    if(n == 0)
+        return res;
+
+    if(init_velocity.empty() || (!stationary.empty() && stationary[0].first == 0))
+        res.col(0).zeros();
+    else
+        res.col(0) = init_velocity;
+
+    // ǰ˶ε, һ֡ٶ׼ȷ(һ֡߾ֹһ֡)
+    index_t segment_start = 0u;
+    size_t next = 0u;
+
+    for(index_t i = 1u; i < n; ++i) {
+        // Ѿľֹ
+        while(next < stationary.size() && stationary[next].second < i)
+            ++next;
+
+        const bool still = next < stationary.size() && stationary[next].first <= i;
+        const value_t* a0 = acce.colptr(i - 1);
+        const value_t* a1 = acce.colptr(i);
+        value_t* v0 = res.colptr(i - 1);
+        value_t* v1 = res.colptr(i);
+
+        if(!still) {
+            for(int c = 0; c < 3; ++c)
+                v1[c] = ((a0[c] + a1[c]) / 2) * delta + v0[c];
+            continue;
+        }
+
+        // 뾲ֹ: ֵõٶȾһ˶ۼƵ, Եط̯˶
+        if(stationary[next].first == i && i > segment_start) {
+            value_t drift[3];
+            for(int c = 0; c < 3; ++c)
+                drift[c] = ((a0[c] + a1[c]) / 2) * delta + v0[c];
+
+            const value_t span = i - segment_start;
+            for(index_t k = segment_start + 1; k < i; ++k) {
+                value_t* v = res.colptr(k);
+                const value_t ratio = (k - segment_start) / span;
+                for(int c = 0; c < 3; ++c)
+                    v[c] -= drift[c] * ratio;
+            }
+        }
+
+        for(int c = 0; c < 3; ++c)
+            v1[c] = 0.0;
+        segment_start = i;
+    }
+
+    return res;
+}
+
+vec zupt_displacement(const mat& velocity, value_t delta)
+{
+    BOOST_ASSERT(velocity.n_rows == 3);
+
+    vec res(3);
+    res.zeros();
+    for(index_t i = 1u; i < velocity.n_cols; ++i) {
+        const value_t* v0 = velocity.colptr(i - 1);
+        const value_t* v1 = velocity.colptr(i);
+        for(int c = 0; c < 3; ++c)
+            res[c] += (v0[c] + v1[c]) / 2 * delta;
+    }
+    return res;
+}
+
+}
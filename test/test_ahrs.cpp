@@ -0,0 +1,129 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/cpu_dispatch.h>
+#include <smfe/feature/ahrs.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+namespace
+{
+vec conjugate(const vec& rot)
+{
+    return make_rotate(rot[0], -rot[1], -rot[2], -rot[3]);
+}
+
+// device豸ģ, һЩ֡ûмٶȻߴ
+mat make_amg(int device, int n)
+{
+    mat amg(9, n);
+    for(int i = 0; i < n; ++i) {
+        for(int c = 0; c < 9; ++c)
+            amg(c, i) = std::sin(0.03 * i * (c + 1) + 0.7 * device + c) + (c == 2 ? 9.8 : 0.0);
+
+        if(i % 37 == 5)
+            amg(0, i) = amg(1, i) = amg(2, i) = 0.0;
+        if(i % 23 == 7)
+            amg(3, i) = amg(4, i) = amg(5, i) = 0.0;
+    }
+    return amg;
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_madgwick_ahrs)
+{
+    // ֹб豸, ӵλԪʼʵ̬
+    vec axis = make_3dvec(1.0, 0.3, -0.2);
+    normalise_vec(axis);
+    const vec truth = make_rotate(0.8, axis);
+
+    const vec gravity = make_3dvec(0.0, 0.0, 9.8);
+    const vec north = make_3dvec(0.4, 0.0, -0.3);
+    const vec amg_v = pack_amg_vec(rotate_3dvec(conjugate(truth), gravity),
+                                   rotate_3dvec(conjugate(truth), north), make_3dvec(0.0, 0.0, 0.0));
+
+    MadgwickAhrs ahrs(0.01, 0.5);
+    for(int i = 0; i < 2000; ++i)
+        ahrs.update(amg_v);
+
+    const vec& rot = ahrs.rotation();
+    const vec earth_acce = rotate_3dvec(rot, vec(amg_v.subvec(0, 2)));
+    const vec earth_mag = rotate_3dvec(rot, vec(amg_v.subvec(3, 5)));
+    for(int c = 0; c < 3; ++c) {
+        BOOST_REQUIRE_SMALL(earth_acce[c] - gravity[c], 1e-6);
+        BOOST_REQUIRE_SMALL(earth_mag[c] - north[c], 1e-6);
+    }
+    BOOST_REQUIRE_CLOSE_FRACTION(std::fabs(arma::dot(rot, truth)), 1.0, 1e-9);
+
+    // ӿڵһк֡µĽͬ
+    mat amg_mat = make_amg(0, 200);
+    MadgwickAhrs a(0.02), b(0.02);
+    mat rot_mat = a.update(amg_mat);
+    for(index_t i = 0u; i < amg_mat.n_cols; ++i) {
+        const vec& r = b.update(vec(amg_mat.col(i)));
+        for(int c = 0; c < 4; ++c)
+            BOOST_REQUIRE_EQUAL(rot_mat(c, i), r[c]);
+    }
+
+    // zת, ûмٶȺʹƵʱֱӻ
+    MadgwickAhrs gyro_only(0.01);
+    vec spin = arma::zeros<vec>(9);
+    spin[8] = 0.5;
+    for(int i = 0; i < 100; ++i)
+        gyro_only.update(spin);
+    BOOST_REQUIRE_CLOSE_FRACTION(2 * std::atan2(gyro_only.rotation()[3], gyro_only.rotation()[0]), 0.5, 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(test_madgwick_ahrs_bank)
+{
+    // 豸ȵ, ʣ豸Ĵ
+    const int n_devices = 11;
+    const int n = 300;
+
+    std::vector<mat> amg_mats(n_devices);
+    for(int d = 0; d < n_devices; ++d)
+        amg_mats[d] = make_amg(d, n);
+
+    set_active_isa(ISA_SCALAR);
+    std::vector<mat> expected(n_devices);
+    for(int d = 0; d < n_devices; ++d) {
+        MadgwickAhrs ahrs(0.02, 0.2);
+        expected[d] = ahrs.update(amg_mats[d]);
+    }
+
+    for(int isa = ISA_SCALAR; isa <= detected_isa(); ++isa) {
+        set_active_isa(static_cast<CpuIsa>(isa));
+
+        MadgwickAhrsBank bank(n_devices, 0.02, 0.2);
+        std::vector<mat> rot_mats;
+        bank.update(amg_mats, rot_mats);
+
+        BOOST_REQUIRE_EQUAL(rot_mats.size(), (size_t)n_devices);
+        for(int d = 0; d < n_devices; ++d) {
+            for(index_t i = 0u; i < rot_mats[d].n_elem; ++i)
+                BOOST_REQUIRE_SMALL(rot_mats[d][i] - expected[d][i], 1e-9);
+
+            vec rot = bank.rotation(d);
+            for(int c = 0; c < 4; ++c)
+                BOOST_REQUIRE_EQUAL(rot[c], rot_mats[d](c, n - 1));
+        }
+
+        // ֡豸
+        bank.reset();
+        mat frames(9, n_devices), rot_frames;
+        for(int i = 0; i < n; ++i) {
+            for(int d = 0; d < n_devices; ++d)
+                frames.col(d) = amg_mats[d].col(i);
+            bank.update(frames, rot_frames);
+        }
+        for(int d = 0; d < n_devices; ++d) {
+            for(int c = 0; c < 4; ++c)
+                BOOST_REQUIRE_SMALL(rot_frames(c, d) - expected[d](c, n - 1), 1e-9);
+        }
+    }
+
+    reset_active_isa();
+}
@@ -0,0 +1,138 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/amg_aligner.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+namespace
+{
+vec signal(int type, value_t t)
+{
+    vec v(3);
+    for(int c = 0; c < 3; ++c)
+        v[c] = (type + 1) * std::sin(1.7 * t + c) + 0.3 * c;
+    return v;
+}
+
+// жʱ
+vec jitter_times(value_t start, value_t period, index_t n, value_t phase)
+{
+    vec times(n);
+    for(index_t i = 0u; i < n; ++i)
+        times[i] = start + period * i + 0.2 * period * std::sin(i * phase);
+    return times;
+}
+
+mat sample(int type, const vec& times)
+{
+    mat data(3, times.size());
+    for(index_t i = 0u; i < times.size(); ++i)
+        data.col(i) = signal(type, times[i]);
+    return data;
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_amg_aligner)
+{
+    vec times[3];
+    times[Acce] = jitter_times(0.013, 0.01, 400, 1.1);
+    times[Mag] = jitter_times(0.021, 0.02, 200, 0.7);
+    times[Gyro] = jitter_times(0.002, 0.005, 800, 1.9);
+
+    mat data[3];
+    for(int type = 0; type < 3; ++type)
+        data[type] = sample(type, times[type]);
+
+    const value_t delta = 0.01;
+    AmgAligner batch(delta);
+    for(int type = 0; type < 3; ++type)
+        batch.push((ChannelType)type, times[type], data[type]);
+
+    mat expected, tail;
+    vec expected_times, tail_times;
+    batch.pull(expected, expected_times);
+    batch.flush(tail, tail_times);
+    BOOST_REQUIRE_GT(expected.n_cols, 350u);
+    BOOST_REQUIRE_GE(tail.n_cols, 1u);
+
+    // һ֡Ϊдݵʱ
+    BOOST_REQUIRE_CLOSE_FRACTION(expected_times[0], times[Mag][0], 1e-12);
+    for(index_t i = 0u; i < expected.n_cols; ++i) {
+        BOOST_REQUIRE_CLOSE_FRACTION(expected_times[i], times[Mag][0] + i * delta, 1e-12);
+        for(int type = 0; type < 3; ++type) {
+            vec truth = signal(type, expected_times[i]);
+            for(int c = 0; c < 3; ++c)
+                BOOST_REQUIRE_SMALL(expected(3 * type + c, i) - truth[c], 2e-4);
+        }
+    }
+
+    // ֿ, һͬ, ݸϽ
+    AmgAligner stream(delta);
+    index_t pushed[3] = {0, 0, 0}, done = 0;
+    const index_t chunk[3] = {6, 3, 12};
+    while(pushed[Acce] < times[Acce].size()) {
+        for(int type = 0; type < 3; ++type) {
+            index_t first = pushed[type];
+            index_t last = std::min(first + chunk[type], (index_t)times[type].size());
+            stream.push((ChannelType)type, times[type].subvec(first, last - 1), data[type].cols(first, last - 1));
+            pushed[type] = last;
+        }
+
+        mat out;
+        vec out_times;
+        index_t n = stream.pull(out, out_times);
+        BOOST_REQUIRE_EQUAL(out.n_cols, n);
+        for(index_t i = 0u; i < n; ++i) {
+            BOOST_REQUIRE_EQUAL(out_times[i], expected_times[done + i]);
+            BOOST_REQUIRE_SMALL(arma::norm(out.col(i) - expected.col(done + i), "inf"), 1e-12);
+        }
+        done += n;
+
+        for(int type = 0; type < 3; ++type)
+            BOOST_REQUIRE_LE(stream.n_buffered((ChannelType)type), chunk[type] + 5);
+    }
+    BOOST_REQUIRE_EQUAL(done, expected.n_cols);
+    BOOST_REQUIRE_EQUAL(stream.n_frames(), expected.n_cols);
+}
+
+BOOST_AUTO_TEST_CASE(test_amg_aligner_channels)
+{
+    // ֻʹüٶȼƺ, ԲֵźǾȷ
+    vec acce_times = jitter_times(0.0, 0.01, 50, 1.3);
+    vec gyro_times = jitter_times(0.004, 0.004, 120, 0.9);
+
+    mat acce(3, acce_times.size()), gyro(3, gyro_times.size());
+    for(index_t i = 0u; i < acce_times.size(); ++i)
+        acce.col(i).fill(2.0 * acce_times[i] + 1.0);
+    for(index_t i = 0u; i < gyro_times.size(); ++i)
+        gyro.col(i).fill(-3.0 * gyro_times[i]);
+
+    AmgAligner aligner(0.02, AcceMask | GyroMask, LINEAR_RESAMPLE);
+    aligner.push(Acce, acce_times, acce);
+    aligner.push(Gyro, gyro_times, gyro);
+    // ֮Ĵݱ
+    aligner.push(Mag, 0.0, arma::ones<vec>(3));
+    BOOST_REQUIRE_EQUAL(aligner.n_buffered(Mag), 0u);
+
+    mat amg, tail;
+    vec times, tail_times;
+    index_t n = aligner.pull(amg, times);
+    index_t n_tail = aligner.flush(tail, tail_times);
+    BOOST_REQUIRE_EQUAL(aligner.n_frames(), n + n_tail);
+    BOOST_REQUIRE_GT(n, 0u);
+
+    amg = arma::join_rows(amg, tail);
+    times = arma::join_cols(times, tail_times);
+    const value_t last_time = std::min(acce_times[acce_times.size() - 1], gyro_times[gyro_times.size() - 1]);
+    BOOST_REQUIRE_LE(times[times.size() - 1], last_time);
+    for(index_t i = 0u; i < amg.n_cols; ++i) {
+        for(int c = 0; c < 3; ++c) {
+            BOOST_REQUIRE_SMALL(amg(c, i) - (2.0 * times[i] + 1.0), 1e-12);
+            BOOST_REQUIRE_EQUAL(amg(3 + c, i), 0.0);
+            BOOST_REQUIRE_SMALL(amg(6 + c, i) + 3.0 * times[i], 1e-12);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/cpu_dispatch.h>
+#include <smfe/feature/calibration.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+using namespace smfe;
+
+BOOST_AUTO_TEST_CASE(test_calibration_model)
+{
+    std::istringstream is(
+        "acce\n"
+        "{\n"
+        "    matrix \"1.01 0.02 0 0 0.99 -0.01 0.03 0 1.02\"\n"
+        "    offset \"0.02 -0.01 0.05\"\n"
+        "}\n"
+        "mag\n"
+        "{\n"
+        "    offset \"12.5 -3.1 40.2\"\n"
+        "}\n");
+    CalibrationModel model = CalibrationModel::from_config(is);
+
+    BOOST_REQUIRE_EQUAL(model.matrix(Acce)(0, 1), 0.02);
+    BOOST_REQUIRE_EQUAL(model.matrix(Acce)(2, 0), 0.03);
+    BOOST_REQUIRE_EQUAL(model.offset(Acce)[2], 0.05);
+    BOOST_REQUIRE_EQUAL(model.matrix(Mag)(1, 1), 1.0);
+    BOOST_REQUIRE_EQUAL(model.offset(Mag)[0], 12.5);
+    BOOST_REQUIRE_EQUAL(model.offset(Gyro)[1], 0.0);
+
+    // ûõǲ
+    const vec amg_v = pack_amg_vec(make_3dvec(0.5, 0.2, 9.8), make_3dvec(30.0, 2.0, -10.0),
+                                   make_3dvec(0.1, -0.3, 0.2));
+    vec calibrated = model.apply(amg_v);
+    vec acce = model.matrix(Acce) * (vec(amg_v.subvec(0, 2)) - model.offset(Acce));
+    for(int c = 0; c < 3; ++c) {
+        BOOST_REQUIRE_SMALL(calibrated[c] - acce[c], 1e-12);
+        BOOST_REQUIRE_SMALL(calibrated[3 + c] - (amg_v[3 + c] - model.offset(Mag)[c]), 1e-12);
+        BOOST_REQUIRE_EQUAL(calibrated[6 + c], amg_v[6 + c]);
+    }
+
+    std::istringstream bad("gyro\n{\n    offset \"1 2\"\n}\n");
+    BOOST_REQUIRE_THROW(CalibrationModel::from_config(bad), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_calibrate_rotate_amg_mat)
+{
+    const int n = 21;
+    mat amg(9, n), rot(4, n);
+    for(int i = 0; i < n; ++i) {
+        for(int c = 0; c < 9; ++c)
+            amg(c, i) = std::sin(0.3 * i * (c + 1) + c) * (c < 3 ? 9.8 : 1.0);
+
+        vec axis = make_3dvec(std::cos(0.1 * i), 1.0, 0.2);
+        normalise_vec(axis);
+        rot.col(i) = make_rotate(0.05 * i, axis);
+    }
+
+    CalibrationModel model;
+    for(int s = 0; s < 3; ++s) {
+        mat m(3, 3);
+        for(int r = 0; r < 3; ++r) {
+            for(int c = 0; c < 3; ++c)
+                m(r, c) = (r == c ? 1.0 : 0.0) + 0.01 * (s + 1) * (r - c + 0.5);
+        }
+        model.set(static_cast<ChannelType>(s), m, make_3dvec(0.1 * s, -0.2, 0.05 * (s + 1)));
+    }
+
+    // УתĽ
+    mat expect = rotate_amg_mat(rot, model.apply(amg));
+
+    for(int isa = ISA_SCALAR; isa <= detected_isa(); ++isa) {
+        set_active_isa(static_cast<CpuIsa>(isa));
+
+        mat fused = calibrate_rotate_amg_mat(model, rot, amg);
+        for(index_t i = 0u; i < fused.n_elem; ++i)
+            BOOST_REQUIRE_SMALL(fused[i] - expect[i], 1e-9);
+
+        mat mag = calibrate_rotate_amg_mat(model, rot, amg, MagMask);
+        BOOST_REQUIRE_EQUAL(mag.n_rows, 3u);
+        for(int f = 0; f < n; ++f) {
+            for(int c = 0; c < 3; ++c)
+                BOOST_REQUIRE_SMALL(mag(c, f) - expect(3 + c, f), 1e-9);
+        }
+    }
+
+    reset_active_isa();
+}
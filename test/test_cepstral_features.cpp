@@ -0,0 +1,75 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/cepstral_features.h>
+#include <smfe/feature/frequency_domain_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+static const value_t PI = 3.14159265358979323846;
+
+BOOST_AUTO_TEST_CASE(test_cepstral_features)
+{
+    const int window = 128;
+    const value_t fs = 50.0;
+    const int n_filters = 12, n_coefficients = 8;
+
+    CepstralFeatures cepstral(window, fs, n_filters, n_coefficients, MEL_FILTER_BANK, 2.0);
+    BOOST_REQUIRE_EQUAL(cepstral.filter_bank().n_rows, (index_t)n_filters);
+    BOOST_REQUIRE_EQUAL(cepstral.filter_bank().n_cols, (index_t)(window / 2 + 1));
+    BOOST_REQUIRE_EQUAL(cepstral.dct().n_rows, (index_t)n_coefficients);
+
+    // ˲Ȩֵ[0, 1]֮, mel̶µƵ˲խ
+    const mat& fb = cepstral.filter_bank();
+    BOOST_REQUIRE(fb.min() >= 0.0 && fb.max() <= 1.0);
+    BOOST_REQUIRE(arma::accu(fb.row(1)) < arma::accu(fb.row(n_filters - 1)));
+
+    // DCT໥
+    mat gram = cepstral.dct() * cepstral.dct().t();
+    for(int i = 0; i < n_coefficients; ++i) {
+        for(int j = 0; j < n_coefficients; ++j)
+            BOOST_REQUIRE_SMALL(gram(i, j) - (i == j ? 1.0 : 0.0), 1e-12);
+    }
+
+    mat windows(window, 20);
+    for(index_t c = 0u; c < windows.n_cols; ++c) {
+        for(int i = 0; i < window; ++i)
+            windows(i, c) = std::sin(2 * PI * (1.0 + 0.3 * c) * i / fs) + 0.2 * std::cos(0.9 * i + c);
+    }
+
+    mat coefficients = cepstral.compute(windows, 3);
+    BOOST_REQUIRE_EQUAL(coefficients.n_rows, (index_t)n_coefficients);
+    BOOST_REQUIRE_EQUAL(coefficients.n_cols, windows.n_cols);
+
+    for(index_t c = 0u; c < windows.n_cols; ++c) {
+        // ֱӰն
+        vec source = windows.col(c);
+        fm_vec fm = frequency_magnitude_vec(source, fs);
+        vec log_energy(n_filters);
+        for(int m = 0; m < n_filters; ++m) {
+            value_t e = 0.0;
+            for(size_t k = 0u; k < fm.size(); ++k)
+                e += fb(m, k) * fm[k].mag * fm[k].mag;
+            log_energy[m] = std::log(e);
+        }
+
+        vec single = cepstral.compute(source);
+        for(int k = 0; k < n_coefficients; ++k) {
+            value_t expect = 0.0;
+            for(int m = 0; m < n_filters; ++m)
+                expect += cepstral.dct()(k, m) * log_energy[m];
+
+            BOOST_REQUIRE_SMALL(coefficients(k, c) - expect, 1e-9);
+            BOOST_REQUIRE_SMALL(single[k] - expect, 1e-9);
+        }
+    }
+
+    // Կ̶˲Ŀͬ
+    vec linear = cepstral_features(windows.col(0), fs, n_filters, n_coefficients, LINEAR_FILTER_BANK);
+    BOOST_REQUIRE_EQUAL(linear.size(), (index_t)n_coefficients);
+    CepstralFeatures uniform(window, fs, n_filters, n_coefficients, LINEAR_FILTER_BANK);
+    BOOST_REQUIRE_CLOSE_FRACTION(arma::accu(uniform.filter_bank().row(2)),
+                                 arma::accu(uniform.filter_bank().row(7)), 0.1);
+}
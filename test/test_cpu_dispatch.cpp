@@ -0,0 +1,124 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/cpu_dispatch.h>
+#include <smfe/feature/statistic_features.h>
+#include <smfe/feature/time_domain_features.h>
+#include <smfe/feature/frequency_domain_features.h>
+#include <smfe/feature/sensor_features.h>
+#include <smfe/feature/mean_filter.h>
+#include <smfe/feature/integral_calculus.h>
+
+#include <stdexcept>
+
+using namespace smfe;
+
+static const value_t error = 1e-9;
+
+// ÿһִϵĽתжӦ
+static void check_rotate_amg_channels(const mat& rot, const mat& amg, const mat& rotated_ref, value_t error)
+{
+    for(int channels = 1; channels <= AmgMask; ++channels) {
+        mat rotated = rotate_amg_channels(rot, amg, channels);
+        BOOST_REQUIRE_EQUAL(rotated.n_rows, (index_t)(3 * channel_count(channels)));
+
+        index_t row = 0u;
+        for(int c = 0; c < 3; ++c) {
+            if(!(channels & channel_mask(static_cast<ChannelType>(c))))
+                continue;
+
+            for(index_t f = 0u; f < amg.n_cols; ++f) {
+                for(int k = 0; k < 3; ++k)
+                    BOOST_REQUIRE_SMALL(rotated(row + k, f) - rotated_ref(3 * c + k, f), error);
+            }
+            row += 3;
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_isa_names)
+{
+    BOOST_REQUIRE_EQUAL(isa_from_string("scalar"), ISA_SCALAR);
+    BOOST_REQUIRE_EQUAL(isa_from_string("avx2"), ISA_AVX2);
+    BOOST_REQUIRE_EQUAL(isa_from_string("avx512"), ISA_AVX512);
+    BOOST_REQUIRE_EQUAL(std::string(isa_name(ISA_AVX2)), "avx2");
+    BOOST_REQUIRE_THROW(isa_from_string("sse9"), std::invalid_argument);
+
+    BOOST_REQUIRE(active_isa() <= detected_isa());
+
+    // ǿлʵ
+    set_active_isa(ISA_SCALAR);
+    BOOST_REQUIRE_EQUAL(active_isa(), ISA_SCALAR);
+    reset_active_isa();
+
+    if(detected_isa() < ISA_AVX512)
+        BOOST_REQUIRE_THROW(set_active_isa(ISA_AVX512), SMFEException);
+}
+
+BOOST_AUTO_TEST_CASE(test_isa_kernels_agree)
+{
+    // Ȳȵı, ÿһkernelβ
+    const int n = 203;
+    vec data(n);
+    for(int i = 0; i < n; ++i)
+        data[i] = std::sin(i * 0.37) * 3.0 + (i % 5) * 0.25 - 0.6;
+
+    mat amg(9, 19), rot(4, 19);
+    for(index_t c = 0u; c < amg.n_cols; ++c) {
+        for(index_t r = 0u; r < 9; ++r)
+            amg(r, c) = data[(c * 9 + r) % n];
+        vec q = make_rotate(1.0 + c, 0.3 * c, -0.2, 0.5);
+        normalise_vec(q);
+        rot.col(c) = q;
+    }
+
+    set_active_isa(ISA_SCALAR);
+    value_t energy_ref = energy(data);
+    value_t mav_ref = mean_absolute_value(data);
+    value_t entropy_ref = entropy(data, 7);
+    vec filter_ref = mean_filter(data, 3);
+    vec mag_ref = fm_get_mag(frequency_magnitude_vec(data, 100.0));
+    mat rotated_ref = rotate_amg_mat(rot, amg);
+    vec cumulative_ref[5];
+    for(int degree = 2; degree <= 4; ++degree)
+        cumulative_ref[degree] = cumulative_integration(data, 0.01, degree);
+
+    for(index_t c = 0u; c < amg.n_cols; ++c) {
+        vec expect = rotate_amg_vec(rot.col(c), amg.col(c));
+        for(index_t r = 0u; r < 9; ++r)
+            BOOST_REQUIRE_SMALL(rotated_ref(r, c) - expect[r], error);
+    }
+
+    check_rotate_amg_channels(rot, amg, rotated_ref, error);
+
+    for(int isa = ISA_AVX2; isa <= detected_isa(); ++isa) {
+        set_active_isa(static_cast<CpuIsa>(isa));
+        BOOST_TEST_MESSAGE("checking " << isa_name(active_isa()));
+
+        BOOST_REQUIRE_CLOSE_FRACTION(energy(data), energy_ref, error);
+        BOOST_REQUIRE_CLOSE_FRACTION(mean_absolute_value(data), mav_ref, error);
+        BOOST_REQUIRE_CLOSE_FRACTION(entropy(data, 7), entropy_ref, error);
+
+        vec filtered = mean_filter(data, 3);
+        for(int i = 0; i < n; ++i)
+            BOOST_REQUIRE_EQUAL(filtered[i], filter_ref[i]);
+
+        vec mag = fm_get_mag(frequency_magnitude_vec(data, 100.0));
+        for(index_t i = 0u; i < mag.size(); ++i)
+            BOOST_REQUIRE_SMALL(mag[i] - mag_ref[i], error);
+
+        mat rotated = rotate_amg_mat(rot, amg);
+        for(index_t i = 0u; i < rotated.n_elem; ++i)
+            BOOST_REQUIRE_SMALL(rotated[i] - rotated_ref[i], error);
+
+        check_rotate_amg_channels(rot, amg, rotated_ref, error);
+
+        for(int degree = 2; degree <= 4; ++degree) {
+            vec cumulative = cumulative_integration(data, 0.01, degree);
+            for(int i = 0; i < n; ++i)
+                BOOST_REQUIRE_SMALL(cumulative[i] - cumulative_ref[degree][i], error);
+        }
+    }
+
+    reset_active_isa();
+}
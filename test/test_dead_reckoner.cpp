@@ -0,0 +1,75 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/dead_reckoner.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+BOOST_AUTO_TEST_CASE(test_dead_reckoner)
+{
+    const int n = 300;
+    const value_t delta = 0.02;
+
+    mat rot(4, n), amg(9, n);
+    for(int i = 0; i < n; ++i) {
+        vec axis = make_3dvec(std::sin(0.01 * i), 1.0, 0.5);
+        normalise_vec(axis);
+        rot.col(i) = make_rotate(0.003 * i, axis);
+
+        // мһξֹ
+        const bool still = i > 120 && i < 180;
+        for(int c = 0; c < 9; ++c)
+            amg(c, i) = still ? 0.0 : std::sin(0.05 * i * (c + 1) + c);
+    }
+
+    const vec init_velocity = make_3dvec(0.1, -0.2, 0.3);
+    const value_t threshold = 0.05;
+    const int station_count = 10;
+
+    DeadReckoner reckoner(delta, init_velocity, threshold, station_count);
+    reckoner.push(mat(rot.cols(0, 99)), mat(amg.cols(0, 99)));
+    for(int i = 100; i < 170; ++i)
+        reckoner.push(vec(rot.col(i)), vec(amg.col(i)));
+
+    // ״̬, ʣµָ֮, ٴõͬĽ
+    DeadReckoner::State saved = reckoner.checkpoint();
+    reckoner.push(mat(rot.cols(170, n - 1)), mat(amg.cols(170, n - 1)));
+    const vec first_velocity = reckoner.velocity();
+    const vec first_position = reckoner.position();
+    const vec first_angle = reckoner.angle();
+
+    reckoner.restore(saved);
+    BOOST_REQUIRE_EQUAL(reckoner.n_frames(), 170u);
+    reckoner.push(mat(rot.cols(170, n - 1)), mat(amg.cols(170, n - 1)));
+    BOOST_REQUIRE_EQUAL(reckoner.n_frames(), (unsigned long long)n);
+
+    // ״̬ĽӿڶݼĽͬ
+    mat global = rotate_amg_mat(rot, amg);
+    for(int c = 0; c < 3; ++c) {
+        vec acce = global.row(c).t();
+        vec gyro = global.row(6 + c).t();
+        value_t expect = velocity(acce, delta, init_velocity[c], threshold, station_count);
+
+        BOOST_REQUIRE_EQUAL(reckoner.velocity()[c], expect);
+        BOOST_REQUIRE_EQUAL(reckoner.velocity()[c], first_velocity[c]);
+        BOOST_REQUIRE_EQUAL(reckoner.position()[c], first_position[c]);
+        BOOST_REQUIRE_EQUAL(reckoner.angle()[c], first_angle[c]);
+
+        value_t angle = 0.0;
+        for(int i = 1; i < n; ++i)
+            angle += (gyro[i - 1] + gyro[i]) / 2 * delta;
+        BOOST_REQUIRE_CLOSE_FRACTION(reckoner.angle()[c], angle, 1e-12);
+    }
+
+    // ֵֹ֮ٶΪ0
+    reckoner.restore(saved);
+    BOOST_REQUIRE_EQUAL(arma::norm(reckoner.velocity(), 2), 0.0);
+
+    reckoner.reset();
+    BOOST_REQUIRE_EQUAL(reckoner.n_frames(), 0u);
+    BOOST_REQUIRE_EQUAL(reckoner.velocity()[1], -0.2);
+    BOOST_REQUIRE_EQUAL(arma::norm(reckoner.position(), 2), 0.0);
+}
@@ -0,0 +1,134 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/dtw.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace smfe;
+
+static const value_t INF = std::numeric_limits<value_t>::infinity();
+
+// ۾ֱʵ
+static value_t full_dtw(const mat& a, const mat& b, int band)
+{
+    const int n = a.n_cols, m = b.n_cols;
+    const int w = band < 0 ? std::max(n, m) : std::max(band, std::abs(n - m));
+
+    mat d(n + 1, m + 1);
+    d.fill(INF);
+    d(0, 0) = 0.0;
+    for(int i = 1; i <= n; ++i) {
+        for(int j = 1; j <= m; ++j) {
+            if(std::abs(i - j) > w)
+                continue;
+            value_t cost = arma::accu(arma::square(a.col(i - 1) - b.col(j - 1)));
+            d(i, j) = cost + std::min(d(i - 1, j - 1), std::min(d(i - 1, j), d(i, j - 1)));
+        }
+    }
+    return d(n, m);
+}
+
+static mat gesture(int n_frames, value_t speed, value_t phase)
+{
+    mat res(3, n_frames);
+    for(int i = 0; i < n_frames; ++i) {
+        res(0, i) = std::sin(speed * i + phase);
+        res(1, i) = std::cos(0.5 * speed * i);
+        res(2, i) = 0.1 * i * speed;
+    }
+    return res;
+}
+
+BOOST_AUTO_TEST_CASE(test_dtw_distance)
+{
+    mat a = gesture(40, 0.20, 0.0);
+    mat b = gesture(40, 0.23, 0.3);
+    mat c = gesture(33, 0.25, 0.1);
+
+    const int bands[] = {-1, 0, 3, 10};
+    for(int i = 0; i < 4; ++i) {
+        BOOST_REQUIRE_CLOSE_FRACTION(dtw_distance(a, b, bands[i]), full_dtw(a, b, bands[i]), 1e-12);
+        BOOST_REQUIRE_CLOSE_FRACTION(dtw_distance(a, c, bands[i]), full_dtw(a, c, bands[i]), 1e-12);
+        BOOST_REQUIRE_CLOSE_FRACTION(dtw_distance(c, a, bands[i]), full_dtw(c, a, bands[i]), 1e-12);
+    }
+    BOOST_REQUIRE_EQUAL(dtw_distance(a, a, 3), 0.0);
+
+    // ͨ
+    vec x = a.row(0).t(), y = b.row(0).t();
+    BOOST_REQUIRE_CLOSE_FRACTION(dtw_distance(x, y, 5), full_dtw(a.row(0), b.row(0), 5), 1e-12);
+
+    // ½粻ᳬʵ
+    const value_t d = dtw_distance(a, b, 4);
+    mat lower, upper;
+    dtw_envelope(b, 4, lower, upper);
+    BOOST_REQUIRE(lb_kim(a, b) <= d);
+    BOOST_REQUIRE(lb_keogh(a, lower, upper) <= d);
+    BOOST_REQUIRE(lb_keogh(a, lower, upper) > 0.0);
+    BOOST_REQUIRE_EQUAL(lb_keogh(b, lower, upper), 0.0);
+
+    // early abandoning
+    BOOST_REQUIRE_EQUAL(dtw_distance(a, b, 4, d * 0.5), INF);
+    BOOST_REQUIRE_CLOSE_FRACTION(dtw_distance(a, b, 4, d), d, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(test_dtw_matcher)
+{
+    const int band = 5;
+    DtwMatcher matcher(band);
+
+    std::vector<mat> templates;
+    for(int i = 0; i < 60; ++i) {
+        templates.push_back(gesture(30 + i % 7, 0.05 + 0.01 * i, 0.07 * i));
+        BOOST_REQUIRE_EQUAL(matcher.add_template(templates.back()), i);
+    }
+    BOOST_REQUIRE_EQUAL(matcher.n_templates(), 60);
+
+    std::vector<mat> queries;
+    for(int q = 0; q < 9; ++q)
+        queries.push_back(gesture(30 + q % 5, 0.06 + 0.05 * q, 0.45 * q) + 0.01 * q);
+
+    DtwMatcher::Stats batch_stats;
+    std::vector<DtwMatcher::Match> batch = matcher.best_matches(queries, 3, &batch_stats);
+    BOOST_REQUIRE_EQUAL(batch.size(), queries.size());
+    BOOST_REQUIRE_EQUAL(batch_stats.kim_pruned + batch_stats.keogh_pruned + batch_stats.abandoned
+                        + batch_stats.computed, 60u * queries.size());
+    BOOST_REQUIRE(batch_stats.kim_pruned + batch_stats.keogh_pruned + batch_stats.abandoned > 0u);
+
+    for(size_t q = 0u; q < queries.size(); ++q) {
+        int expect_index = -1;
+        value_t expect = INF;
+        for(size_t i = 0u; i < templates.size(); ++i) {
+            value_t d = full_dtw(queries[q], templates[i], band);
+            if(d < expect) {
+                expect = d;
+                expect_index = i;
+            }
+        }
+
+        DtwMatcher::Match single = matcher.best_match(queries[q]);
+        DtwMatcher::Match threaded = matcher.best_match(queries[q], 4);
+        BOOST_REQUIRE_EQUAL(single.index, expect_index);
+        BOOST_REQUIRE_CLOSE_FRACTION(single.distance, expect, 1e-12);
+        BOOST_REQUIRE_EQUAL(threaded.index, expect_index);
+        BOOST_REQUIRE_EQUAL(batch[q].index, expect_index);
+    }
+
+    // ֮߳乲֦ľ, ͬģڲͬ߳ʱȻСһ
+    DtwMatcher ties(band);
+    for(int i = 0; i < 16; ++i)
+        ties.add_template(i == 15 ? templates[2] : templates[i]);
+    for(int n_threads = 1; n_threads <= 8; ++n_threads) {
+        DtwMatcher::Stats tie_stats;
+        DtwMatcher::Match m = ties.best_match(templates[2], n_threads, &tie_stats);
+        BOOST_REQUIRE_EQUAL(m.index, 2);
+        BOOST_REQUIRE_EQUAL(m.distance, 0.0);
+        BOOST_REQUIRE_EQUAL(tie_stats.kim_pruned + tie_stats.keogh_pruned + tie_stats.abandoned
+                            + tie_stats.computed, 16u);
+    }
+
+    DtwMatcher empty;
+    BOOST_REQUIRE_EQUAL(empty.best_match(queries[0]).index, -1);
+}
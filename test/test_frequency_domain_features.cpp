@@ -1,8 +1,13 @@
 #include <boost/test/unit_test.hpp>
 
+#include <cstdio>
 #include <iostream>
 using namespace std;
 
+#include <boost/filesystem/operations.hpp>
+namespace bf = boost::filesystem;
+
+#include <smfe/fft_config.h>
 #include <smfe/feature/time_domain_features.h>
 #include <smfe/feature/statistic_features.h>
 #include <smfe/feature/frequency_domain_features.h>
@@ -71,4 +76,129 @@ BOOST_AUTO_TEST_CASE(test_ifft)
 	for(auto ite = sum.begin(); ite != sum.end(); ++ite, ++i) {
 		BOOST_REQUIRE_CLOSE_FRACTION(*ite, back_res[i], error);
 	}
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(test_fft_any_length)
+{
+	const value_t PI = 3.14159265358979323846;
+
+	// 2ݴκȵĽֱӼdftͬ
+	const int sizes[] = {1, 16, 97, 100, 250};
+	for(int s = 0; s < 5; ++s) {
+		const int n = sizes[s];
+		vec source(n);
+		for(int i = 0; i < n; ++i)
+			source[i] = std::sin(0.37 * i) + 0.2 * i;
+
+		cx_vec spectrum = smfe_fft(source);
+		BOOST_REQUIRE_EQUAL(spectrum.size(), n);
+		for(int k = 0; k < n; ++k) {
+			complex_t expect(0.0, 0.0);
+			for(int i = 0; i < n; ++i)
+				expect += source[i] * std::polar(1.0, -2.0 * PI * k * i / n);
+			BOOST_REQUIRE_SMALL(std::abs(spectrum[k] - expect), 1e-9 * n);
+		}
+	}
+
+	BOOST_REQUIRE_EQUAL(fft_fast_size(1), 1);
+	BOOST_REQUIRE_EQUAL(fft_fast_size(97), 98);
+	BOOST_REQUIRE_EQUAL(fft_fast_size(100), 100);
+	BOOST_REQUIRE_EQUAL(fft_fast_size(101), 105);
+	BOOST_REQUIRE_EQUAL(fft_fast_size(211), 216);
+}
+
+BOOST_AUTO_TEST_CASE(test_padded_frequency_magnitude)
+{
+	const value_t PI = 3.14159265358979323846;
+	const value_t fs = 100.0;
+
+	vec source(100);
+	for(int i = 0; i < 100; ++i)
+		source[i] = 1.5 + 2.0 * std::sin(2 * PI * 10.0 * i / fs);
+
+	fm_vec fm = frequency_magnitude_vec(source, fs);
+	fm_vec padded = padded_frequency_magnitude_vec(source, fs, 200);
+
+	// 0֮ƵʼΪ fs/n_fft, ԭƵʵϷֵ
+	BOOST_REQUIRE_EQUAL(padded.size(), 101u);
+	for(size_t i = 0u; i < padded.size(); ++i)
+		BOOST_REQUIRE_CLOSE_FRACTION(padded[i].fre + 1.0, i * fs / 200 + 1.0, 1e-12);
+	for(size_t i = 0u; i < fm.size(); ++i)
+		BOOST_REQUIRE_SMALL(padded[2 * i].mag - fm[i].mag, 1e-9);
+
+	BOOST_REQUIRE_CLOSE_FRACTION(padded[0].mag, 1.5, 1e-9);
+	BOOST_REQUIRE_CLOSE_FRACTION(padded[20].mag, 2.0, 1e-9);
+
+	// Ĭϲ0ĳ
+	fm_vec prime = padded_frequency_magnitude_vec(make_sub_range(source, 0, 97), fs);
+	BOOST_REQUIRE_EQUAL(prime.size(), 98u / 2 + 1);
+	BOOST_REQUIRE_CLOSE_FRACTION(prime[1].fre, fs / 98, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(test_fft_batch)
+{
+	const value_t fs = 50.0;
+
+	// С, Ȳ2ݴ
+	mat windows(100, 75);
+	for(index_t c = 0u; c < windows.n_cols; ++c) {
+		for(index_t r = 0u; r < windows.n_rows; ++r)
+			windows(r, c) = std::sin(0.1 * (c + 1) * r) + 0.01 * c;
+	}
+
+	cx_mat spectrum = smfe_fft_batch(windows);
+	mat mags = frequency_magnitude_mat(windows);
+	BOOST_REQUIRE_EQUAL(spectrum.n_rows, 51u);
+	BOOST_REQUIRE_EQUAL(spectrum.n_cols, 75u);
+	BOOST_REQUIRE_EQUAL(mags.n_rows, 51u);
+	BOOST_REQUIRE_EQUAL(mags.n_cols, 75u);
+
+	for(index_t c = 0u; c < windows.n_cols; ++c) {
+		vec column = windows.col(c);
+		cx_vec expect = smfe_fft(column);
+		fm_vec fm = frequency_magnitude_vec(column, fs);
+		for(index_t r = 0u; r < spectrum.n_rows; ++r) {
+			BOOST_REQUIRE_SMALL(std::abs(spectrum(r, c) - expect[r]), 1e-9);
+			BOOST_REQUIRE_SMALL(mags(r, c) - fm[r].mag, 1e-12);
+		}
+	}
+
+	// ̵߳Ľ͵߳ͬ
+	cx_mat threaded = smfe_fft_batch(windows, 4);
+	for(index_t i = 0u; i < spectrum.n_elem; ++i)
+		BOOST_REQUIRE_SMALL(std::abs(threaded[i] - spectrum[i]), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(test_fft_wisdom)
+{
+	// ÿʹòͬʱļ, еĲԲụӰ
+	const std::string path = (bf::temp_directory_path() / bf::unique_path("smfe_test_wisdom_%%%%-%%%%-%%%%.txt")).string();
+	std::remove(path.c_str());
+
+	// һʱûwisdom
+	BOOST_REQUIRE(!fft_init(path, FFT_MEASURE));
+	BOOST_REQUIRE_EQUAL(fft_planning_level(), FFT_MEASURE);
+
+	std::vector<int> sizes;
+	sizes.push_back(100);
+	sizes.push_back(123);
+	fft_prepare(sizes);
+	BOOST_REQUIRE(fft_save_wisdom());
+
+	// һ֮ǰwisdom, Ľ
+	BOOST_REQUIRE(fft_init(path, FFT_MEASURE));
+	vec source = arma::linspace<vec>(0.0, 1.0, 123);
+	cx_vec spectrum = smfe_fft(source);
+	BOOST_REQUIRE_CLOSE_FRACTION(spectrum[0].real(), arma::accu(source), 1e-9);
+
+	BOOST_REQUIRE(fft_export_wisdom(path));
+	BOOST_REQUIRE(fft_import_wisdom(path));
+	std::remove(path.c_str());
+
+	BOOST_REQUIRE(!fft_import_wisdom("not_exist_dir/wisdom.txt"));
+
+	// ָĬ, Ӱ
+	BOOST_REQUIRE(!fft_init("", FFT_ESTIMATE));
+	BOOST_REQUIRE_EQUAL(fft_planning_level(), FFT_ESTIMATE);
+	BOOST_REQUIRE(!fft_save_wisdom());
+}
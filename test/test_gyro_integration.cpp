@@ -0,0 +1,85 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/gyro_integration.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+namespace
+{
+const value_t PI = 3.14159265358979323846;
+
+value_t rot_distance(const vec& a, const vec& b)
+{
+    return 1.0 - std::fabs(arma::dot(a, b));
+}
+
+vec multiply(const vec& a, const vec& b)
+{
+    return make_rotate(a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3],
+                       a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2],
+                       a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1],
+                       a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0]);
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_integrate_gyro)
+{
+    const value_t delta = 0.01;
+    const vec init_rot = make_rotate(PI / 2, x_unit_vec);
+
+    // ƾֲzת, ֲzȫΪ -y
+    mat amg = arma::zeros<mat>(9, 101);
+    amg.row(8).fill(1.0);
+
+    GyroIntegration res = integrate_gyro(amg, delta, init_rot);
+    BOOST_REQUIRE_SMALL(rot_distance(res.rotation, multiply(init_rot, make_rotate(1.0, z_unit_vec))), 1e-12);
+    BOOST_REQUIRE_SMALL(res.angle[0], 1e-12);
+    BOOST_REQUIRE_CLOSE_FRACTION(res.angle[1], -1.0, 1e-12);
+    BOOST_REQUIRE_SMALL(res.angle[2], 1e-12);
+    BOOST_REQUIRE_CLOSE_FRACTION(res.total_angle, 1.0, 1e-12);
+
+    // xת90, µyת90, ĳת˳й
+    const int n = 2000;
+    mat seq = arma::zeros<mat>(9, 2 * n);
+    for(int i = 0; i < 2 * n; ++i)
+        seq(i < n ? 6 : 7, i) = PI / 2 / (n * delta);
+
+    res = integrate_gyro(seq, delta);
+    const vec expected = multiply(make_rotate(PI / 2, x_unit_vec), make_rotate(PI / 2, y_unit_vec));
+    BOOST_REQUIRE_SMALL(rot_distance(res.rotation, expected), 1e-6);
+
+    // лһ֡ʹƽٶ
+    const value_t step = PI / 2 / n;
+    BOOST_REQUIRE_CLOSE_FRACTION(res.total_angle, 2 * (n - 1) * step + step / std::sqrt(2.0), 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(test_integrate_gyro_windows)
+{
+    const int n = 500;
+    mat amg(9, n);
+    for(int i = 0; i < n; ++i) {
+        for(int c = 0; c < 9; ++c)
+            amg(c, i) = std::sin(0.02 * i * (c + 1) + c);
+    }
+
+    index_pair_vec windows;
+    for(index_t first = 0u; first + 100 <= (index_t)n; first += 37)
+        windows.push_back(index_pair_t(first, first + 99));
+
+    const vec init_rot = make_rotate(0.3, y_unit_vec);
+    std::vector<GyroIntegration> res = integrate_gyro_windows(amg, windows, 0.02, init_rot, 3);
+    BOOST_REQUIRE_EQUAL(res.size(), windows.size());
+
+    for(size_t w = 0u; w < windows.size(); ++w) {
+        GyroIntegration one = integrate_gyro(amg.cols(windows[w].first, windows[w].second), 0.02, init_rot);
+        for(int c = 0; c < 4; ++c)
+            BOOST_REQUIRE_EQUAL(res[w].rotation[c], one.rotation[c]);
+        for(int c = 0; c < 3; ++c)
+            BOOST_REQUIRE_EQUAL(res[w].angle[c], one.angle[c]);
+        BOOST_REQUIRE_EQUAL(res[w].total_angle, one.total_angle);
+    }
+}
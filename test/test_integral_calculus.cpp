@@ -0,0 +1,113 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/integral_calculus.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+BOOST_AUTO_TEST_CASE(test_cumulative_integration)
+{
+    // ȳڲֿĴС
+    const index_t n = 701;
+    const value_t delta = 0.01;
+    vec data(n), truth(n);
+    for(index_t i = 0u; i < n; ++i) {
+        value_t t = i * delta;
+        data[i] = std::cos(3.0 * t);
+        truth[i] = 0.5 + std::sin(3.0 * t) / 3.0;
+    }
+
+    value_t max_error[5] = {0.0};
+    for(int degree = 2; degree <= 4; ++degree) {
+        vec res = cumulative_integration(data, delta, degree, 0.5);
+        BOOST_REQUIRE_EQUAL(res.size(), n);
+        BOOST_REQUIRE_EQUAL(res[0], 0.5);
+        for(index_t i = 0u; i < n; ++i)
+            max_error[degree] = std::max(max_error[degree], std::fabs(res[i] - truth[i]));
+
+        // ǵȼĽӿʹͬļʱͬ
+        vec res_vec = cumulative_integration(data, vec(n - 1).fill(delta), degree, 0.5);
+        for(index_t i = 0u; i < n; ++i)
+            BOOST_REQUIRE_SMALL(res_vec[i] - res[i], 1e-12);
+    }
+    BOOST_REQUIRE_LT(max_error[2], 1e-4);
+    BOOST_REQUIRE_LT(max_error[3], 1e-6);
+    BOOST_REQUIRE_LT(max_error[4], 1e-8);
+
+    // degreeΪ2ʱһĻ
+    vec res = cumulative_integration(data, delta, 2);
+    BOOST_REQUIRE_CLOSE_FRACTION(res[n - 1], integration(data, 2) * delta, 1e-12);
+
+    // ζʽ degree Ϊ4 ʱǾȷ
+    vec cubic(9);
+    for(index_t i = 0u; i < cubic.size(); ++i)
+        cubic[i] = i * i * (value_t)i - 2.0 * i;
+    res = cumulative_integration(cubic, 1.0, 4);
+    for(index_t i = 0u; i < cubic.size(); ++i)
+        BOOST_REQUIRE_SMALL(res[i] - (std::pow((value_t)i, 4) / 4 - (value_t)(i * i)), 1e-9);
+
+    // ݸdegree
+    res = cumulative_integration(vec(1).fill(2.0), 1.0, 4, 3.0);
+    BOOST_REQUIRE_EQUAL(res.size(), 1u);
+    BOOST_REQUIRE_EQUAL(res[0], 3.0);
+    // ʹöβֵ, ĻֺSimpsonʽͬ
+    res = cumulative_integration(cubic.subvec(0, 2), 1.0, 4);
+    BOOST_REQUIRE_SMALL(res[2] - (cubic[0] + 4 * cubic[1] + cubic[2]) / 3, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(test_cumulative_integration_non_uniform)
+{
+    const index_t n = 300;
+    vec times(n), data(n), delta_vec(n - 1);
+    for(index_t i = 0u; i < n; ++i) {
+        times[i] = 0.01 * i + 0.003 * std::sin(i * 1.3);
+        data[i] = std::cos(3.0 * times[i]);
+    }
+    for(index_t i = 0u; i + 1 < n; ++i)
+        delta_vec[i] = times[i + 1] - times[i];
+
+    vec trapz = cumulative_integration(data, delta_vec, 2);
+    BOOST_REQUIRE_EQUAL(trapz[n - 1], integration(data, delta_vec));
+
+    for(int degree = 2; degree <= 4; ++degree) {
+        vec res = cumulative_integration(data, delta_vec, degree);
+        for(index_t i = 0u; i < n; ++i) {
+            value_t truth = (std::sin(3.0 * times[i]) - std::sin(3.0 * times[0])) / 3.0;
+            BOOST_REQUIRE_SMALL(res[i] - truth, degree == 2 ? 1e-4 : 1e-6);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_cumulative_trajectory)
+{
+    const index_t n = 400;
+    const value_t delta = 0.005;
+    vec acce(n);
+    for(index_t i = 0u; i < n; ++i)
+        acce[i] = std::sin(2.0 * i * delta);
+
+    vec velocity, position;
+    cumulative_trajectory(acce, velocity, position, delta, 4, 1.0, 2.0);
+    vec v = cumulative_integration(acce, delta, 4, 1.0);
+    vec p = cumulative_integration(v, delta, 4, 2.0);
+    for(index_t i = 0u; i < n; ++i) {
+        BOOST_REQUIRE_EQUAL(velocity[i], v[i]);
+        BOOST_REQUIRE_EQUAL(position[i], p[i]);
+
+        value_t t = i * delta;
+        BOOST_REQUIRE_SMALL(position[i] - (2.0 + 1.5 * t - std::sin(2.0 * t) / 4.0), 1e-9);
+    }
+
+    // ԭػ, ÿһеΪ
+    mat amg(9, n);
+    for(index_t r = 0u; r < amg.n_rows; ++r)
+        amg.row(r) = (acce * (r + 1.0)).t();
+    cumulative_integration_rows(amg, delta, 3);
+    vec row_ref = cumulative_integration(acce, delta, 3);
+    for(index_t r = 0u; r < amg.n_rows; ++r) {
+        for(index_t i = 0u; i < n; ++i)
+            BOOST_REQUIRE_SMALL(amg(r, i) - (r + 1.0) * row_ref[i], 1e-12);
+    }
+}
@@ -0,0 +1,90 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/mag_calibration.h>
+#include <smfe/feature/calibration.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+namespace
+{
+// ʹûƽϾȡ, ټźӲŸ
+mat make_mag(int n, const mat& distortion, const vec& offset, value_t field, int phase = 0)
+{
+    mat res(3, n);
+    for(int i = 0; i < n; ++i) {
+        value_t z = 1.0 - 2.0 * (i + 0.5) / n;
+        value_t r = std::sqrt(1.0 - z * z);
+        value_t a = 2.39996322972865332 * (i + phase);
+        vec s = make_3dvec(r * std::cos(a), r * std::sin(a), z) * field;
+        res.col(i) = distortion * s + offset;
+    }
+    return res;
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_mag_calibration)
+{
+    mat distortion(3, 3);
+    distortion << 1.10 << 0.05 << -0.02 << arma::endr
+               << 0.05 << 0.92 << 0.03 << arma::endr
+               << -0.02 << 0.03 << 1.01 << arma::endr;
+    const vec offset = make_3dvec(20.0, -10.0, 35.0);
+    mat mag = make_mag(500, distortion, offset, 45.0);
+
+    // amgӿֻʹôƵ
+    mat amg = arma::zeros<mat>(9, mag.n_cols);
+    amg.rows(3, 5) = mag;
+
+    MagCalibrationEstimator estimator;
+    BOOST_REQUIRE(!estimator.solve());
+    estimator.push_amg(amg);
+    BOOST_REQUIRE_EQUAL(estimator.n_samples(), 500u);
+    BOOST_REQUIRE(estimator.solve());
+
+    for(int c = 0; c < 3; ++c)
+        BOOST_REQUIRE_SMALL(estimator.offset()[c] - offset[c], 1e-6);
+
+    // У֮ͬһ
+    for(index_t i = 0u; i < mag.n_cols; ++i) {
+        vec corrected = estimator.matrix() * (vec(mag.col(i)) - estimator.offset());
+        BOOST_REQUIRE_CLOSE_FRACTION(arma::norm(corrected, 2), estimator.radius(), 1e-6);
+    }
+
+    CalibrationModel model;
+    estimator.apply_to(model);
+    vec calibrated = model.apply(vec(amg.col(7)));
+    BOOST_REQUIRE_CLOSE_FRACTION(arma::norm(vec(calibrated.subvec(3, 5)), 2), estimator.radius(), 1e-6);
+
+    // һƽϵʱ޷, ֮ǰĽ
+    MagCalibrationEstimator planar;
+    for(int i = 0; i < 100; ++i)
+        planar.push(make_3dvec(std::cos(0.1 * i), std::sin(0.1 * i), 0.0));
+    BOOST_REQUIRE(!planar.solve());
+    BOOST_REQUIRE_EQUAL(planar.offset()[0], 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(test_mag_calibration_forgetting)
+{
+    const mat distortion = arma::eye<mat>(3, 3);
+
+    // 仯֮, ɵ𽥱
+    MagCalibrationEstimator estimator(0.99);
+    estimator.push_amg(join_cols(join_cols(arma::zeros<mat>(3, 1000),
+                                           make_mag(1000, distortion, make_3dvec(5.0, 5.0, 5.0), 40.0)),
+                                 arma::zeros<mat>(3, 1000)));
+    BOOST_REQUIRE(estimator.solve());
+    BOOST_REQUIRE_SMALL(estimator.offset()[0] - 5.0, 1e-6);
+
+    const vec moved = make_3dvec(-8.0, 12.0, 3.0);
+    mat mag = make_mag(3000, distortion, moved, 40.0, 17);
+    for(index_t i = 0u; i < mag.n_cols; ++i)
+        estimator.push(vec(mag.col(i)));
+
+    BOOST_REQUIRE(estimator.solve());
+    for(int c = 0; c < 3; ++c)
+        BOOST_REQUIRE_SMALL(estimator.offset()[c] - moved[c], 1e-4);
+}
@@ -0,0 +1,61 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/statistic_features.h>
+#include <smfe/feature/time_domain_features.h>
+#include <smfe/feature/moment_accumulator.h>
+
+#include <cmath>
+using namespace smfe;
+
+static const value_t error = 1e-9;
+
+BOOST_AUTO_TEST_CASE(test_moment_accumulator)
+{
+    value_t d[] = { 2, 7, 4, 9, 3};
+    vec data = make_vec(d, 5);
+
+    MomentAccumulator acc;
+    acc.update(data);
+
+    BOOST_REQUIRE_EQUAL(acc.count(), 5);
+    BOOST_REQUIRE_CLOSE_FRACTION(acc.mean(), 5.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(acc.var(), smfe::var(data), error);
+    BOOST_REQUIRE_CLOSE_FRACTION(acc.var(1), smfe::var(data, 1), error);
+    BOOST_REQUIRE_CLOSE_FRACTION(acc.stddev(), smfe::stddev(data), error);
+    BOOST_REQUIRE_CLOSE_FRACTION(acc.skewness(), 0.406040288214, 1e-6);
+    BOOST_REQUIRE_CLOSE_FRACTION(acc.kurtosis(), -1.39965397924, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(test_moment_accumulator_merge)
+{
+    const int total = 10001;
+
+    // һܴƫ, ֵȶ
+    vec data(total);
+    for(int i = 0; i < total; ++i)
+        data[i] = 1e6 + std::sin(i * 0.37) * 3 + std::cos(i * 0.011) * (i % 7);
+
+    MomentAccumulator whole;
+    whole.update(data);
+
+    MomentAccumulator merged;
+    for(int beg = 0; beg < total; beg += 999) {
+        MomentAccumulator part;
+        part.update(make_sub_range(data, beg, std::min(beg + 999, total)));
+        merged.merge(part);
+    }
+
+    MomentAccumulator threaded = accumulate_moments(data, 4);
+
+    BOOST_REQUIRE_EQUAL(merged.count(), total);
+    BOOST_REQUIRE_EQUAL(threaded.count(), total);
+
+    BOOST_REQUIRE_CLOSE_FRACTION(merged.mean(), smfe::mean(data), error);
+    BOOST_REQUIRE_CLOSE_FRACTION(merged.var(), smfe::var(data), 1e-6);
+
+    BOOST_REQUIRE_CLOSE_FRACTION(merged.skewness(), whole.skewness(), 1e-6);
+    BOOST_REQUIRE_CLOSE_FRACTION(merged.kurtosis(), whole.kurtosis(), 1e-6);
+    BOOST_REQUIRE_CLOSE_FRACTION(threaded.skewness(), whole.skewness(), 1e-6);
+    BOOST_REQUIRE_CLOSE_FRACTION(threaded.kurtosis(), whole.kurtosis(), 1e-6);
+}
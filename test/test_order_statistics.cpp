@@ -0,0 +1,69 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/statistic_features.h>
+#include <smfe/feature/time_domain_features.h>
+#include <smfe/feature/order_statistics.h>
+
+#include <cstdlib>
+using namespace smfe;
+
+static const value_t error = 1e-9;
+
+BOOST_AUTO_TEST_CASE(test_order_statistics)
+{
+    value_t d[] = { 2, 7, 4, 9, 3};
+    vec data = make_vec(d, 5);
+
+    OrderStatistics os(data);
+    BOOST_REQUIRE_EQUAL(os.size(), 5);
+    BOOST_REQUIRE_EQUAL(os.min(), 2);
+    BOOST_REQUIRE_EQUAL(os.max(), 9);
+    BOOST_REQUIRE_EQUAL(os.first_quater(), first_quater(data));
+    BOOST_REQUIRE_EQUAL(os.third_quater(), third_quater(data));
+    BOOST_REQUIRE_EQUAL(os.quartile_deviation(), quartile_deviation(data));
+    BOOST_REQUIRE_CLOSE_FRACTION(os.median(), smfe::median(data), error);
+
+    for(int i = 0; i < 5; ++i)
+        BOOST_REQUIRE_EQUAL(os.nth(i), get_nth_elem(data, i));
+
+    BOOST_REQUIRE_CLOSE_FRACTION(os.quantile(0.0), 2.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(os.quantile(1.0), 9.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(os.percentile(50), 4.0, error);
+    // λ 0.6 * 4 = 2.4, 47֮
+    BOOST_REQUIRE_CLOSE_FRACTION(os.quantile(0.6), 4.0 + 0.4 * 3.0, error);
+
+    vec even_data("6 3 4 2 1 5");
+    BOOST_REQUIRE_CLOSE_FRACTION(OrderStatistics(even_data).median(), 3.5, error);
+}
+
+BOOST_AUTO_TEST_CASE(test_rolling_order_statistics)
+{
+    const int window = 16;
+    const int total = 200;
+
+    vec data(total);
+    for(int i = 0; i < total; ++i)
+        data[i] = (std::rand() % 50) - 25.0;
+
+    RollingOrderStatistics ros(window);
+    for(int i = 0; i < total; ++i) {
+        ros.push(data[i]);
+
+        int beg = i + 1 > window ? i + 1 - window : 0;
+        vec cur = make_sub_range(data, beg, i + 1);
+        OrderStatistics os(cur);
+
+        BOOST_REQUIRE_EQUAL(ros.size(), cur.size());
+        BOOST_REQUIRE_EQUAL(ros.min(), os.min());
+        BOOST_REQUIRE_EQUAL(ros.max(), os.max());
+        BOOST_REQUIRE_EQUAL(ros.first_quater(), os.first_quater());
+        BOOST_REQUIRE_EQUAL(ros.third_quater(), os.third_quater());
+        BOOST_REQUIRE_CLOSE_FRACTION(ros.median(), os.median(), error);
+        BOOST_REQUIRE_CLOSE_FRACTION(ros.percentile(90), os.percentile(90), error);
+    }
+
+    BOOST_REQUIRE(ros.full());
+    ros.clear();
+    BOOST_REQUIRE_EQUAL(ros.size(), 0);
+}
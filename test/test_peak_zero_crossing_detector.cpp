@@ -0,0 +1,69 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/peak_zero_crossing_detector.h>
+#include <smfe/feature/time_domain_features.h>
+
+#include <vector>
+
+using namespace smfe;
+
+BOOST_AUTO_TEST_CASE(test_peak_zero_crossing_events)
+{
+    value_t d[] = {0.0, 0.0, -1.0, 1.0, 1.9, -2.3, 2.5, 2.7, 6.9, -10.0,
+                   7.1, 3.8, 2.3, 1.5, 1.3, 1.2, 1.4, 3.4, 1.5, 1.3, 1.2, 1.4, 0.0};
+    vec data = make_vec(d, sizeof(d) / sizeof(d[0]));
+
+    PeakZeroCrossingDetector detector(data.size());
+    std::vector<PeakZeroCrossingDetector::Event> events;
+    detector.push(data, events);
+
+    std::vector<index_t> peaks, zero_crossings;
+    for(size_t i = 0u; i < events.size(); ++i) {
+        if(events[i].type == PeakZeroCrossingDetector::PEAK)
+            peaks.push_back((index_t)events[i].index);
+        else
+            zero_crossings.push_back((index_t)events[i].index);
+    }
+
+    index_vec expect_peaks = peak_index(data);
+    index_vec expect_zero_crossings = zero_crossing_index(data);
+
+    BOOST_REQUIRE_EQUAL(peaks.size(), expect_peaks.size());
+    for(size_t i = 0u; i < peaks.size(); ++i)
+        BOOST_REQUIRE_EQUAL(peaks[i], expect_peaks[i]);
+
+    BOOST_REQUIRE_EQUAL(zero_crossings.size(), expect_zero_crossings.size());
+    for(size_t i = 0u; i < zero_crossings.size(); ++i)
+        BOOST_REQUIRE_EQUAL(zero_crossings[i], expect_zero_crossings[i]);
+
+    BOOST_REQUIRE_EQUAL(detector.peak_count(), expect_peaks.size());
+    BOOST_REQUIRE_EQUAL(detector.zero_crossing_count(), expect_zero_crossings.size());
+}
+
+BOOST_AUTO_TEST_CASE(test_peak_zero_crossing_window)
+{
+    const int n = 300, window = 25;
+    vec data(n);
+    for(int i = 0; i < n; ++i)
+        data[i] = std::sin(i * 0.9) + 0.4 * std::cos(i * 2.3) - 0.1;
+
+    PeakZeroCrossingDetector detector(window);
+    for(int i = 0; i < n; ++i) {
+        detector.push(data[i]);
+
+        // еļֱӶԴĽһ
+        int beg = i + 1 >= window ? i + 1 - window : 0;
+        vec w = make_sub_range(data, beg, i + 1);
+        if(w.size() >= 3)
+            BOOST_REQUIRE_EQUAL(detector.peak_count(), peak_index(w).size());
+        BOOST_REQUIRE_EQUAL(detector.zero_crossing_count(), zero_crossing_index(w).size());
+    }
+
+    BOOST_REQUIRE_CLOSE_FRACTION(detector.zero_crossing_rate(50.0),
+                                 detector.zero_crossing_count() * 50.0 / window, 1e-12);
+
+    detector.clear();
+    BOOST_REQUIRE_EQUAL(detector.position(), 0u);
+    BOOST_REQUIRE_EQUAL(detector.peak_count(), 0u);
+}
@@ -0,0 +1,84 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/statistic_features.h>
+#include <smfe/feature/order_statistics.h>
+#include <smfe/feature/quantile_sketch.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+using namespace smfe;
+
+// valueеĹһλ
+static value_t normalized_rank(const vec& sorted, value_t value)
+{
+    auto ite = std::lower_bound(sorted.begin(), sorted.end(), value);
+    return (value_t)(ite - sorted.begin()) / sorted.size();
+}
+
+BOOST_AUTO_TEST_CASE(test_quantile_sketch_exact)
+{
+    value_t d[] = { 2, 7, 4, 9, 3};
+    vec data = make_vec(d, 5);
+
+    QuantileSketch sketch;
+    sketch.update(data);
+
+    BOOST_REQUIRE_EQUAL(sketch.size(), 5);
+    BOOST_REQUIRE_EQUAL(sketch.min(), 2);
+    BOOST_REQUIRE_EQUAL(sketch.max(), 9);
+    BOOST_REQUIRE_EQUAL(sketch.first_quater(), first_quater(data));
+    BOOST_REQUIRE_EQUAL(sketch.third_quater(), third_quater(data));
+    BOOST_REQUIRE_EQUAL(sketch.median(), 4);
+
+    // kݵʱ OrderStatistics Ĳֵλһ
+    OrderStatistics stats(data);
+    const value_t ps[] = {0.0, 0.1, 0.3, 0.5, 0.6, 0.95, 1.0};
+    vec qs = sketch.quantiles(make_vec(ps, 7));
+    for(int i = 0; i < 7; ++i) {
+        BOOST_REQUIRE_CLOSE(sketch.quantile(ps[i]), stats.quantile(ps[i]), 1e-10);
+        BOOST_REQUIRE_EQUAL(qs[i], sketch.quantile(ps[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_quantile_sketch_error_bound)
+{
+    const int total = 100000;
+    const int chunks = 4;
+
+    vec data(total);
+    for(int i = 0; i < total; ++i)
+        data[i] = std::sin(i * 0.01) * 10 + (value_t)std::rand() / RAND_MAX;
+
+    QuantileSketch whole;
+    whole.update(data);
+
+    // ֶμ֮ϲ
+    QuantileSketch merged;
+    for(int c = 0; c < chunks; ++c) {
+        QuantileSketch part(200, c + 1);
+        part.update(make_sub_range(data, c * total / chunks, (c + 1) * total / chunks));
+        merged.merge(part);
+    }
+
+    BOOST_REQUIRE_EQUAL(merged.size(), total);
+    BOOST_REQUIRE(whole.retained() < total / 50);
+    BOOST_REQUIRE(merged.retained() < total / 50);
+
+    vec sorted = OrderStatistics(data).sorted();
+    value_t eps = whole.normalized_rank_error();
+
+    const value_t ps[] = {0.1, 0.25, 0.5, 0.75, 0.9};
+    for(int i = 0; i < 5; ++i) {
+        BOOST_REQUIRE_SMALL(normalized_rank(sorted, whole.quantile(ps[i])) - ps[i], eps);
+        BOOST_REQUIRE_SMALL(normalized_rank(sorted, merged.quantile(ps[i])) - ps[i], eps);
+    }
+
+    BOOST_REQUIRE_SMALL(normalized_rank(sorted, merged.first_quater()) - 0.25, eps);
+    BOOST_REQUIRE_SMALL(normalized_rank(sorted, merged.median()) - 0.5, eps);
+    BOOST_REQUIRE_SMALL(normalized_rank(sorted, merged.third_quater()) - 0.75, eps);
+
+    vec qs = merged.quantiles(make_vec(ps, 5));
+    BOOST_REQUIRE_EQUAL(qs[2], merged.quantile(0.5));
+}
@@ -0,0 +1,113 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/rot_resampler.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+namespace
+{
+value_t rot_distance(const vec& a, const vec& b)
+{
+    return 1.0 - std::fabs(arma::dot(a, b));
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_resample_rot_mat)
+{
+    // 10Hz, amg33Hz, zת
+    const value_t w = 1.3;
+    vec rot_times(21);
+    mat rot_mat(4, 21);
+    for(index_t i = 0u; i < rot_times.size(); ++i) {
+        rot_times[i] = 0.1 * i;
+        rot_mat.col(i) = make_rotate(w * rot_times[i], z_unit_vec);
+    }
+    // ͬһתһֱʾ, ֵӦŽ϶̵Ļ
+    rot_mat.col(7) *= -1;
+
+    vec target_times(70);
+    for(index_t i = 0u; i < target_times.size(); ++i)
+        target_times[i] = -0.05 + i / 33.0;
+
+    mat slerp = resample_rot_mat(rot_mat, rot_times, target_times);
+    mat nlerp = resample_rot_mat(rot_mat, rot_times, target_times, NLERP_INTERPOLATION);
+    BOOST_REQUIRE_EQUAL(slerp.n_rows, 4u);
+    BOOST_REQUIRE_EQUAL(slerp.n_cols, target_times.size());
+
+    for(index_t i = 0u; i < target_times.size(); ++i) {
+        // ֮ʹ˵Ԫ
+        value_t t = std::min(std::max(target_times[i], 0.0), 2.0);
+        vec expected = make_rotate(w * t, z_unit_vec);
+        BOOST_REQUIRE_SMALL(rot_distance(slerp.col(i), expected), 1e-12);
+        BOOST_REQUIRE_SMALL(rot_distance(nlerp.col(i), expected), 1e-5);
+        BOOST_REQUIRE_CLOSE_FRACTION(arma::norm(nlerp.col(i), 2), 1.0, 1e-12);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_rot_resampler)
+{
+    vec rot_times(30);
+    mat rot_mat(4, 30);
+    for(index_t i = 0u; i < rot_times.size(); ++i) {
+        rot_times[i] = 0.02 + 0.07 * i + 0.01 * std::sin(i * 1.0);
+        vec axis(3);
+        axis[0] = 1.0;
+        axis[1] = std::cos(i * 0.3);
+        axis[2] = 0.5;
+        rot_mat.col(i) = make_rotate(0.2 * i, axis / arma::norm(axis, 2));
+    }
+
+    vec target_times(100);
+    for(index_t i = 0u; i < target_times.size(); ++i)
+        target_times[i] = 0.02 * i;
+
+    mat expected = resample_rot_mat(rot_mat, rot_times, target_times);
+
+    // ԪĿʱֿ鵽, ͬ
+    RotResampler resampler;
+    mat out;
+    BOOST_REQUIRE_EQUAL(resampler.resample(target_times, out), 0u);
+
+    index_t pushed = 0, done = 0;
+    while(done < target_times.size()) {
+        index_t last = std::min(done + 9, (index_t)target_times.size());
+        index_t n = resampler.resample(target_times.subvec(done, last - 1), out);
+        BOOST_REQUIRE_EQUAL(out.n_cols, n);
+        for(index_t i = 0u; i < n; ++i)
+            BOOST_REQUIRE_SMALL(arma::norm(out.col(i) - expected.col(done + i), "inf"), 1e-12);
+        done += n;
+
+        // ֻ滹õԪ
+        BOOST_REQUIRE_LE(resampler.n_buffered(), 5u);
+
+        // ʣµĿҪ֮Ԫ
+        if(done < last && pushed < rot_times.size()) {
+            index_t end = std::min(pushed + 3, (index_t)rot_times.size());
+            resampler.push(rot_mat.cols(pushed, end - 1), rot_times.subvec(pushed, end - 1));
+            pushed = end;
+        }
+    }
+    BOOST_REQUIRE_EQUAL(pushed, rot_times.size());
+
+    // ǵλȵԪ(ڵһԪ֮ǰڲʱϵĿ)ߵĽҲȫͬ
+    mat scaled = rot_mat * 1.001;
+    vec edge_times(4);
+    edge_times[0] = 0.0;
+    edge_times[1] = rot_times[0];
+    edge_times[2] = rot_times[5];
+    edge_times[3] = rot_times[rot_times.size() - 1];
+    mat scaled_expected = resample_rot_mat(scaled, rot_times, edge_times);
+
+    RotResampler scaled_resampler;
+    scaled_resampler.push(scaled, rot_times);
+    BOOST_REQUIRE_EQUAL(scaled_resampler.resample(edge_times, out), edge_times.size());
+    for(index_t i = 0u; i < out.n_cols; ++i) {
+        BOOST_REQUIRE_CLOSE_FRACTION(arma::norm(out.col(i), 2), 1.0, 1e-12);
+        for(int c = 0; c < 4; ++c)
+            BOOST_REQUIRE_EQUAL(out(c, i), scaled_expected(c, i));
+    }
+}
@@ -113,6 +113,16 @@ BOOST_AUTO_TEST_CASE(test_velocity)
         auto res = velocity(make_vec(stdvec), 1.0, 0.0, 7.0, 1);
         BOOST_REQUIRE_EQUAL(res, stdres.back());
     }
+
+    // ֵС1ҲҪʵֵֵȽ, ܱضϳ0
+    {
+        std::vector<value_t> small;
+        small += 0.5, -0.25, 0.75, 0.125;
+
+        // ֻ0.50.75ֵ, Ϊ 0.25 + 0.375 + 0.375
+        auto res = velocity(make_vec(small), 1.0, 0.0, 0.3);
+        BOOST_REQUIRE_EQUAL(res, 1.0);
+    }
 }
 
 BOOST_AUTO_TEST_CASE(test_distance)
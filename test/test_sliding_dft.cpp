@@ -0,0 +1,55 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/sliding_dft.h>
+#include <smfe/feature/frequency_domain_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+static const value_t PI = 3.14159265358979323846;
+
+BOOST_AUTO_TEST_CASE(test_sliding_dft)
+{
+    const int window = 100;
+    const value_t fs = 50.0;
+
+    vec data(731);
+    for(index_t i = 0u; i < data.size(); ++i)
+        data[i] = 0.7 + 2.0 * std::sin(2 * PI * 2.0 * i / fs) + 0.5 * std::sin(2 * PI * 8.5 * i / fs + 1.0)
+                  + 0.1 * std::cos(i * 0.77);
+
+    SlidingDft sdft(window, fs);
+    sdft.add_bin(0);
+    int gait = sdft.add_band(1.0, 3.0);
+    sdft.push(make_sub_range(data, 0, 37));
+    // ;Ƶʹôеݼ
+    int tremor = sdft.add_band(4.0, 12.0);
+
+    for(index_t t = 37u; t < data.size(); ++t) {
+        sdft.push(data[t]);
+        if(t + 1 < (index_t)window || (t % 23) != 0)
+            continue;
+
+        fm_vec fm = frequency_magnitude_vec(make_sub_range(data, t + 1 - window, t + 1), fs);
+
+        for(int i = 0; i < sdft.n_bins(); ++i) {
+            FrequencyMagnitude b = sdft.bin(i);
+            int k = (int)(b.fre * window / fs + 0.5);
+            BOOST_REQUIRE_CLOSE_FRACTION(b.fre, fm[k].fre, 1e-9);
+            BOOST_REQUIRE_SMALL(b.mag - fm[k].mag, 1e-9);
+        }
+
+        value_t gait_energy = 0.0, tremor_energy = 0.0;
+        for(int k = 2; k <= 6; ++k)
+            gait_energy += fm[k].mag * fm[k].mag;
+        for(int k = 8; k <= 24; ++k)
+            tremor_energy += fm[k].mag * fm[k].mag;
+
+        BOOST_REQUIRE_CLOSE_FRACTION(sdft.band_energy(gait), gait_energy, 1e-9);
+        BOOST_REQUIRE_CLOSE_FRACTION(sdft.band_energy(tremor), tremor_energy, 1e-9);
+        BOOST_REQUIRE_CLOSE_FRACTION(sdft.dominant().fre, 2.0, 1e-9);
+        BOOST_REQUIRE_CLOSE_FRACTION(sdft.dominant().mag, 2.0, 1e-2);
+    }
+}
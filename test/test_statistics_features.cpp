@@ -4,6 +4,7 @@
 
 #include <smfe/global.h>
 #include <smfe/feature/statistic_features.h>
+#include <smfe/feature/histogram_entropy.h>
 
 using namespace smfe;
 
@@ -57,4 +58,43 @@ BOOST_AUTO_TEST_CASE(test_common_func)
     BOOST_REQUIRE_CLOSE_FRACTION(first_quater(data), 2.0, error);
     BOOST_REQUIRE_CLOSE_FRACTION(third_quater(data), 4.0, error);
 
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_and_sliding_entropy)
+{
+    value_t error = 1e-9;
+
+    value_t d[] = {0, 0.3, 2.5, 0.5, 3, 1, 1.2, 2, 2.3, 2.4};
+    vec data(d, 10);
+
+    // ÿһΪһ
+    mat windows(10, 3);
+    windows.col(0) = data;
+    windows.col(1) = data * 2.0 - 1.0;
+    windows.col(2).fill(1.5);
+
+    vec res = entropy(windows, 3);
+    BOOST_REQUIRE_EQUAL(res.size(), 3);
+    BOOST_REQUIRE_CLOSE_FRACTION(res[0], entropy(data, 3), error);
+    BOOST_REQUIRE_CLOSE_FRACTION(res[1], entropy(data, 3), error);
+    BOOST_REQUIRE_SMALL(res[2], error);
+
+    // ̶[0, 3]µĻ
+    const int window = 4;
+    SlidingEntropy sliding(window, 3, 0.0, 3.0);
+    for(int i = 0; i < 10; ++i) {
+        sliding.push(data[i]);
+
+        int beg = i + 1 > window ? i + 1 - window : 0;
+        std::vector<int> count(3, 0);
+        for(int j = beg; j <= i; ++j)
+            ++count[data[j] >= 3.0 ? 2 : (int)data[j]];
+
+        value_t sum = 0.0, n = i + 1 - beg;
+        for(int j = 0; j < 3; ++j) {
+            value_t p = count[j] / n;
+            if(p > 0) sum += p*log(p)/log(2);
+        }
+        BOOST_REQUIRE_SMALL(sliding.entropy() + sum, error);
+    }
+}
@@ -0,0 +1,111 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/stft.h>
+#include <smfe/feature/window_function.h>
+#include <smfe/feature/frequency_domain_features.h>
+#include <smfe/feature/statistic_features.h>
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace smfe;
+
+static const value_t error = 1e-9;
+static const value_t PI = 3.14159265358979323846;
+
+static vec make_signal(int n, value_t fs)
+{
+    vec data(n);
+    for(int i = 0; i < n; ++i)
+        data[i] = 1.3 + 4.0 * std::sin(2 * PI * 12.5 * i / fs) + 0.9 * std::cos(2 * PI * 25.0 * i / fs + 0.3);
+    return data;
+}
+
+BOOST_AUTO_TEST_CASE(test_window_function)
+{
+    vec hann = make_window(HANN_WINDOW, 5);
+    BOOST_REQUIRE_SMALL(hann[0], error);
+    BOOST_REQUIRE_CLOSE_FRACTION(hann[1], 0.5, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(hann[2], 1.0, error);
+
+    vec hamming = make_window(HAMMING_WINDOW, 5);
+    BOOST_REQUIRE_CLOSE_FRACTION(hamming[0], 0.53836 - 0.46164, error);
+
+    vec barlett = make_window(BARLETT_WINDOW, 5);
+    BOOST_REQUIRE_CLOSE_FRACTION(barlett[1], 0.5, error);
+
+    BOOST_REQUIRE_EQUAL(window_type_from_string("Blackman"), BLACKMAN_WINDOW);
+    BOOST_REQUIRE_THROW(window_type_from_string("Kaiser"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_stft_rectangular_matches_fm_vec)
+{
+    const value_t fs = 200.0;
+    const int frame = 64, hop = 16;
+    vec data = make_signal(300, fs);
+
+    Stft stft(frame, hop, fs, RECTANGULAR_WINDOW, 8);
+    index_t n_frames = stft.compute(data);
+    BOOST_REQUIRE_EQUAL(n_frames, (300u - frame) / hop + 1);
+    BOOST_REQUIRE_EQUAL(stft.magnitude().n_rows, (index_t)stft.n_bins());
+    BOOST_REQUIRE_EQUAL(stft.magnitude().n_cols, n_frames);
+
+    for(index_t f = 0u; f < n_frames; ++f) {
+        vec frame_data = make_sub_range(data, f * hop, f * hop + frame);
+        fm_vec fm = frequency_magnitude_vec(frame_data, fs);
+        vec mags = fm_get_mag(fm);
+
+        for(int i = 0; i < stft.n_bins(); ++i) {
+            BOOST_REQUIRE_CLOSE_FRACTION(stft.frequencies()[i], fm[i].fre, error);
+            BOOST_REQUIRE_SMALL(stft.magnitude()(i, f) - mags[i], 1e-9);
+        }
+
+        BOOST_REQUIRE_CLOSE_FRACTION(stft.features().energy[f], frequency_energy(fm), 1e-9);
+        BOOST_REQUIRE_CLOSE_FRACTION(stft.features().entropy[f], frequency_domain_entropy(mags, 8), 1e-9);
+        BOOST_REQUIRE_CLOSE_FRACTION(stft.features().principal_frequency[f], 12.5, error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_stft_streaming)
+{
+    const value_t fs = 100.0;
+    vec data = make_signal(517, fs);
+
+    // hop Сںʹ֡
+    int hops[] = {10, 48};
+    for(int h = 0; h < 2; ++h) {
+        Stft batch(32, hops[h], fs, HANN_WINDOW);
+        index_t n_frames = batch.compute(data);
+
+        Stft stream(32, hops[h], fs, HANN_WINDOW);
+        index_t column = 0u;
+        for(index_t beg = 0u; beg < data.size(); beg += 37) {
+            index_t end = beg + 37 < data.size() ? beg + 37 : data.size();
+            index_t n = stream.push(make_sub_range(data, beg, end));
+
+            for(index_t f = 0u; f < n; ++f, ++column) {
+                for(int i = 0; i < stream.n_bins(); ++i)
+                    BOOST_REQUIRE_CLOSE_FRACTION(stream.magnitude()(i, f), batch.magnitude()(i, column), error);
+                BOOST_REQUIRE_CLOSE_FRACTION(stream.features().centroid[f], batch.features().centroid[column], error);
+            }
+        }
+
+        BOOST_REQUIRE_EQUAL(column, n_frames);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_stft_window_amplitude)
+{
+    // ƵʸպƵʵ, Ӵֵ֮Ȼȷ
+    const value_t fs = 128.0;
+    vec data(128);
+    for(int i = 0; i < 128; ++i)
+        data[i] = 3.0 * std::sin(2 * PI * 16.0 * i / fs);
+
+    Stft stft(128, 128, fs, HANN_WINDOW);
+    BOOST_REQUIRE_EQUAL(stft.compute(data), 1u);
+    BOOST_REQUIRE_CLOSE_FRACTION(stft.magnitude()(16, 0), 3.0, 1e-4);
+    BOOST_REQUIRE_CLOSE_FRACTION(stft.features().principal_frequency[0], 16.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(stft.features().centroid[0], 16.0, 1e-3);
+}
@@ -4,6 +4,8 @@
 #include <smfe/global.h>
 #include <smfe/feature/time_domain_features.h>
 #include <smfe/feature/statistic_features.h>
+#include <smfe/feature/integral_calculus.h>
+#include <smfe/feature/sensor_features.h>
 
 #include <iostream>
 using namespace std;
@@ -134,4 +136,57 @@ BOOST_AUTO_TEST_CASE(test_sma)
     data += -2, -7, 4, -9, 3;
 
     BOOST_REQUIRE_CLOSE_FRACTION(sma(make_vec(data)), 22.5, error);
-}
\ No newline at end of file
+}
+
+BOOST_AUTO_TEST_CASE(test_simd_reduce)
+{
+    // ͬȸsimd kernelβ
+    for(int n = 1; n <= 70; n += 3) {
+        vec data(n);
+        for(int i = 0; i < n; ++i)
+            data[i] = (i % 7) * 0.75 - 2.0 + (i % 2 ? 0.1 : -0.3);
+
+        value_t sum = 0.0, sum_sq = 0.0, sum_abs = 0.0;
+        for(int i = 0; i < n; ++i) {
+            sum += data[i];
+            sum_sq += data[i] * data[i];
+            sum_abs += fabs(data[i]);
+        }
+
+        value_t m = sum / n, sum_abs_dev = 0.0;
+        for(int i = 0; i < n; ++i)
+            sum_abs_dev += fabs(data[i] - m);
+
+        BOOST_REQUIRE_CLOSE_FRACTION(energy(data), sum_sq, error);
+        BOOST_REQUIRE_CLOSE_FRACTION(mean_absolute_value(data), sum_abs / n, error);
+        BOOST_REQUIRE_CLOSE_FRACTION(mean_absolute_deviation(data), sum_abs_dev / n, error);
+
+        if(n >= 2) {
+            value_t expect = sum_abs - (fabs(data[0]) + fabs(data[n-1])) / 2;
+            BOOST_REQUIRE_CLOSE_FRACTION(sma(data), expect, error);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_short_window_integration)
+{
+    //  2*(degree-1) ʱ˵Ȩص
+    std::vector<value_t> data;
+    data += 3, -1, 2, 4, 1;
+
+    BOOST_REQUIRE_CLOSE_FRACTION(integration(make_vec(data).subvec(0, 0), 2), 3.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(integration(make_vec(data).subvec(0, 1), 3), 2.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(integration(make_vec(data).subvec(0, 2), 3), -5.0 / 6, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(integration(make_vec(data), 4), 5.5, error);
+
+    // degree-1ʱʹõͽ׵Ĺʽ
+    BOOST_REQUIRE_CLOSE_FRACTION(integration(make_vec(data).subvec(0, 0), 3), 3.0, error);
+    BOOST_REQUIRE_CLOSE_FRACTION(integration(make_vec(data).subvec(0, 1), 4), 2.0, error);
+
+    BOOST_REQUIRE_CLOSE_FRACTION(sma(make_vec(data).subvec(1, 1)), 1.0, error);
+
+    // ٶΪ [0, 1.5, 4], ʹĬϵdegree 3
+    std::vector<value_t> acce;
+    acce += 1, 2, 3;
+    BOOST_REQUIRE_CLOSE_FRACTION(distance(make_vec(acce)), 19.0 / 6, error);
+}
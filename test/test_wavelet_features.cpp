@@ -5,10 +5,12 @@ namespace bf = boost::filesystem;
 #include <config.h>
 #include <smfe/feature/wavelet_features.h>
 #include <smfe/feature/statistic_features.h>
+#include <smfe/feature/frequency_domain_features.h>
 
 #include <string>
 #include <vector>
 #include <fstream>
+#include <thread>
 
 using namespace std;
 
@@ -199,4 +201,54 @@ BOOST_AUTO_TEST_CASE(test_dwt_energy)
         auto wavelet_signal = dwt(signal, wavelet_name, level, length);
         BOOST_REQUIRE_EQUAL(dwt_energy(signal, wavelet_name, level, 1), dwt_energy(wavelet_signal, length, 1));
     }
-}
\ No newline at end of file
+}
+
+// dwtconvfftsmfe_fftfftwplanner, ߳ͬʱĽ͵һ
+BOOST_AUTO_TEST_CASE(test_dwt_concurrent_with_fft)
+{
+    auto input = get_test_signal();
+    const string wavelet_name = "db3";
+    const int level = 4;
+    const int rounds = 50;
+
+    dwt_length_vec length;
+    const vec expected_dwt = smfe::dwt(input, wavelet_name, level, length);
+
+    // ÿһʹòͬĳ, ֤fft߳һֱµļƻ
+    std::vector<cx_vec> expected_fft(rounds);
+    for(int i = 0; i < rounds; ++i)
+        expected_fft[i] = smfe::smfe_fft(input, 300 + i);
+
+    std::vector<vec> dwt_res(rounds);
+    std::vector<cx_vec> fft_res(rounds);
+    std::thread fft_thread([&]() {
+        for(int i = 0; i < rounds; ++i)
+            fft_res[i] = smfe::smfe_fft(input, 300 + rounds + i);
+    });
+    for(int i = 0; i < rounds; ++i) {
+        dwt_length_vec l;
+        dwt_res[i] = smfe::dwt(input, wavelet_name, level, l);
+    }
+    fft_thread.join();
+
+    for(int i = 0; i < rounds; ++i) {
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(dwt_res[i].begin(), dwt_res[i].end(), expected_dwt.begin(), expected_dwt.end());
+        BOOST_REQUIRE_EQUAL(fft_res[i].size(), 300u + rounds + i);
+    }
+
+    // Ѿƻĳ, Ľ֮ǰȫһ
+    std::thread cached_thread([&]() {
+        for(int i = 0; i < rounds; ++i)
+            fft_res[i] = smfe::smfe_fft(input, 300 + i);
+    });
+    for(int i = 0; i < rounds; ++i) {
+        dwt_length_vec l;
+        dwt_res[i] = smfe::dwt(input, wavelet_name, level, l);
+    }
+    cached_thread.join();
+
+    for(int i = 0; i < rounds; ++i) {
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(fft_res[i].begin(), fft_res[i].end(), expected_fft[i].begin(), expected_fft[i].end());
+        BOOST_REQUIRE_EQUAL_COLLECTIONS(dwt_res[i].begin(), dwt_res[i].end(), expected_dwt.begin(), expected_dwt.end());
+    }
+}
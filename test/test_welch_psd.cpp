@@ -0,0 +1,62 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/welch_psd.h>
+#include <smfe/feature/frequency_domain_features.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+using namespace smfe;
+
+static const value_t PI = 3.14159265358979323846;
+
+BOOST_AUTO_TEST_CASE(test_welch_psd)
+{
+    const value_t fs = 64.0;
+
+    vec data(4000);
+    for(index_t i = 0u; i < data.size(); ++i)
+        data[i] = 1.5 * std::sin(2 * PI * 4.0 * i / fs) + 0.3 * std::cos(2 * PI * 12.5 * i / fs)
+                  + 0.05 * std::sin(i * 1.37);
+
+    // δֻһ,  frequency_magnitude_vec ͬ
+    {
+        vec sub = make_sub_range(data, 0, 256);
+        fm_vec expect = frequency_magnitude_vec(sub, fs);
+        fm_vec res = welch_frequency_magnitude_vec(sub, fs, 256, 0, RECTANGULAR_WINDOW);
+
+        BOOST_REQUIRE_EQUAL(res.size(), expect.size());
+        for(size_t i = 0u; i < res.size(); ++i) {
+            BOOST_REQUIRE_SMALL(res[i].fre - expect[i].fre, 1e-9);
+            BOOST_REQUIRE_SMALL(res[i].mag - expect[i].mag, 1e-9);
+        }
+    }
+
+    WelchPsd welch(128, 64, fs);
+    const vec& psd = welch.compute(data);
+    BOOST_REQUIRE_EQUAL(welch.n_segments(), (4000u - 128u) / 64u + 1u);
+    BOOST_REQUIRE_EQUAL(psd.size(), 65u);
+
+    // ܶȵĻֵźŵľֵ
+    value_t mean_square = arma::dot(data, data) / data.size();
+    value_t df = fs / 128;
+    BOOST_REQUIRE_CLOSE_FRACTION(arma::accu(psd) * df, mean_square, 2e-2);
+
+    fm_vec fm = welch.frequency_magnitude_vec();
+    BOOST_REQUIRE_CLOSE_FRACTION(fm[25].fre, 12.5, 1e-9);
+    BOOST_REQUIRE_CLOSE_FRACTION(fm[25].mag, 0.3, 2e-2);
+
+    std::sort(fm.begin(), fm.end(), std::greater<FrequencyMagnitude>());
+    BOOST_REQUIRE_CLOSE_FRACTION(principal_frequency(fm), 4.0, 1e-9);
+    BOOST_REQUIRE_CLOSE_FRACTION(fm[0].mag, 1.5, 2e-2);
+
+    // ̵߳Ľ͵߳ͬ
+    vec single = psd;
+    WelchPsd threaded(128, 64, fs);
+    threaded.compute(data, 4);
+    BOOST_REQUIRE_EQUAL(threaded.n_segments(), welch.n_segments());
+    for(index_t i = 0u; i < single.size(); ++i)
+        BOOST_REQUIRE_SMALL(threaded.psd()[i] - single[i], 1e-12 * (1.0 + single[i]));
+}
@@ -0,0 +1,76 @@
+#include <boost/test/unit_test.hpp>
+
+#include <smfe/global.h>
+#include <smfe/feature/zupt.h>
+#include <smfe/feature/sensor_features.h>
+
+#include <cmath>
+
+using namespace smfe;
+
+static const value_t PI = 3.14159265358979323846;
+
+BOOST_AUTO_TEST_CASE(test_zupt)
+{
+    const value_t g = 9.8;
+    const value_t delta = 0.01;
+
+    // ξֹ֮xһ: ٶΪһڵ, ٶӺص0
+    // ֹ [0, 49], ˶ [50, 149], ֹ [150, 249], ˶ [250, 349], ֹ [350, 399]
+    const int n = 400;
+    mat global_acce(3, n), amg(9, n);
+    global_acce.zeros();
+    amg.zeros();
+    for(int i = 0; i < n; ++i) {
+        int phase = -1;
+        if(i >= 50 && i < 150)
+            phase = i - 50;
+        else if(i >= 250 && i < 350)
+            phase = i - 250;
+
+        if(phase >= 0) {
+            global_acce(0, i) = 2.0 * std::sin(2 * PI * phase / 100);
+            amg(6, i) = 0.5;
+        }
+
+        // ֹʱ⵽
+        amg(0, i) = global_acce(0, i);
+        amg(2, i) = g;
+    }
+
+    StationaryDetector detector(g, 0.05, 0.01, 0.1, 2, 10);
+    index_pair_vec stationary = detector.detect(amg);
+    BOOST_REQUIRE_EQUAL(stationary.size(), 3u);
+    BOOST_REQUIRE_EQUAL(stationary[0].first, 0u);
+    BOOST_REQUIRE(stationary[0].second >= 45u && stationary[0].second <= 50u);
+    BOOST_REQUIRE(stationary[1].first >= 150u && stationary[1].first <= 155u);
+    BOOST_REQUIRE(stationary[1].second >= 245u && stationary[1].second <= 250u);
+    BOOST_REQUIRE(stationary[2].first >= 350u && stationary[2].first <= 355u);
+    BOOST_REQUIRE_EQUAL(stationary[2].second, (index_t)(n - 1));
+
+    // ûƫʱ velocity Ļֽͬ
+    mat v = zupt_velocity(global_acce, delta, stationary);
+    vec vx = global_acce.row(0).t();
+    BOOST_REQUIRE_SMALL(v(0, 120) - velocity(make_sub_range(vx, 0, 121), delta), 1e-12);
+
+    // ƫ֮, ٶھֹΪ0, λƺûƫʱӽ
+    mat biased = global_acce;
+    biased.row(0) += 0.05;
+    biased.row(1) -= 0.03;
+    mat corrected = zupt_velocity(biased, delta, stationary);
+    for(size_t s = 0u; s < stationary.size(); ++s) {
+        for(index_t i = stationary[s].first; i <= stationary[s].second; ++i)
+            BOOST_REQUIRE_SMALL(arma::norm(corrected.col(i), 2), 1e-12);
+    }
+
+    vec expect = zupt_displacement(v, delta);
+    vec res = zupt_displacement(corrected, delta);
+    BOOST_REQUIRE(expect[0] > 0.5);
+    BOOST_REQUIRE_SMALL(res[0] - expect[0], 0.02);
+    BOOST_REQUIRE_SMALL(res[1], 0.02);
+    BOOST_REQUIRE_SMALL(res[2], 1e-12);
+
+    // ûʱƫۻܴ
+    mat uncorrected = zupt_velocity(biased, delta, index_pair_vec());
+    BOOST_REQUIRE(std::abs(zupt_displacement(uncorrected, delta)[0] - expect[0]) > 0.2);
+}